@@ -20,13 +20,390 @@
  * - Chiffrement et déchiffrement RSA simplifié
  */
 
+// mmap, open, fstat... (POSIX) pour le chargement des fichiers binaires
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define BIGBINARY_MMAP 1
+#endif
+
 #include "bigbinary.h"
 #include <limits.h>
+#include <stddef.h>
+
+#if BIGBINARY_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Instructions SSE2 (toujours présentes en x86-64) pour le texte binaire
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Extensions x86-64 (BMI2, ADX, AVX2, AVX-512) détectées à l'exécution:
+// les noyaux qui les utilisent sont compilés avec l'attribut target(...),
+// le reste du fichier garde les options de compilation génériques
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BIGBINARY_X86 1
+#include <immintrin.h>
+#include <cpuid.h>
+#endif
 
 // ============================================================================
 // ==================== PHASE 1: INITIALISATION ET MANIPULATION ===============
 // ============================================================================
 
+/*
+ * === AJOUT: Allocateur personnalisable ===
+ *
+ * Toute la mémoire interne de la bibliothèque (tableaux de bits, limbes
+ * et tampons temporaires) passe par allocation() / liberation(), qui
+ * appellent l'allocateur du thread s'il y en a un, sinon l'allocateur
+ * global, sinon malloc. Seules les chaînes rendues à l'appelant (à
+ * libérer avec free) restent allouées par malloc.
+ *
+ * Les noyaux ne savent pas échouer: un refus de l'allocateur (NULL) est
+ * fatal, message puis abort(), au lieu d'un déréférencement de NULL. Seul
+ * le chargement de fichiers (allocationTentee) rend l'échec à l'appelant.
+ */
+
+// Alignement garanti par malloc (celui du type le plus exigeant)
+#define ALIGNEMENT_NATUREL offsetof(struct { char c; union { long double ld; void *p; long long ll; } u; }, u)
+
+/**
+ * \brief Allocation alignée par défaut: malloc, ou sur-allocation si l'alignement dépasse celui de malloc
+ *
+ * Dans le second cas, l'adresse rendue par malloc est rangée juste avant
+ * la zone alignée pour pouvoir la libérer.
+ */
+static void *allouerParDefaut(size_t taille, size_t alignement, void *contexte) {
+    (void)contexte;
+    if (alignement <= ALIGNEMENT_NATUREL) return malloc(taille);
+
+    char *brut = malloc(taille + alignement + sizeof(void *));
+    if (brut == NULL) return NULL;
+    uintptr_t adresse = (uintptr_t)(brut + sizeof(void *));
+    char *aligne = (char *)((adresse + alignement - 1) & ~(uintptr_t)(alignement - 1));
+    ((void **)aligne)[-1] = brut;
+    return aligne;
+}
+
+static void libererParDefaut(void *ptr, size_t taille, size_t alignement, void *contexte) {
+    (void)taille;
+    (void)contexte;
+    if (ptr == NULL) return;
+    if (alignement <= ALIGNEMENT_NATUREL) {
+        free(ptr);
+    } else {
+        free(((void **)ptr)[-1]);
+    }
+}
+
+static void *reallouerParDefaut(void *ptr, size_t ancienneTaille, size_t nouvelleTaille,
+                                size_t alignement, void *contexte) {
+    if (alignement <= ALIGNEMENT_NATUREL) return realloc(ptr, nouvelleTaille);
+
+    void *nouveau = allouerParDefaut(nouvelleTaille, alignement, contexte);
+    if (nouveau != NULL && ptr != NULL) {
+        memcpy(nouveau, ptr, ancienneTaille < nouvelleTaille ? ancienneTaille : nouvelleTaille);
+        libererParDefaut(ptr, ancienneTaille, alignement, contexte);
+    }
+    return nouveau;
+}
+
+static const AllocateurBigBinary allocateurParDefaut = {
+    allouerParDefaut, reallouerParDefaut, libererParDefaut, NULL
+};
+
+// Allocateur global (NULL = malloc) et, si le compilateur le permet, par thread
+static const AllocateurBigBinary *allocateurGlobal = NULL;
+#if defined(__GNUC__) || defined(__clang__)
+#define BIGBINARY_ALLOCATEUR_THREAD 1
+static __thread const AllocateurBigBinary *allocateurThread = NULL;
+#endif
+
+/**
+ * \brief Installe l'allocateur global de la bibliothèque
+ * \param allocateur Fonctions à utiliser (NULL pour revenir à malloc/free)
+ *
+ * À appeler avant de créer des nombres ou de lancer des threads. La
+ * structure doit rester valide tant que de la mémoire qu'elle a fournie
+ * est en circulation. Chaque tableau de bits retient l'allocateur qui
+ * l'a fourni et lui est toujours rendu, même après un changement.
+ */
+void definirAllocateur(const AllocateurBigBinary *allocateur) {
+    allocateurGlobal = allocateur;
+}
+
+/**
+ * \brief Installe un allocateur pour le thread courant seulement
+ * \param allocateur Fonctions à utiliser (NULL pour revenir à l'allocateur global)
+ * \return false si le compilateur ne permet pas de variable par thread
+ */
+bool definirAllocateurThread(const AllocateurBigBinary *allocateur) {
+#if BIGBINARY_ALLOCATEUR_THREAD
+    allocateurThread = allocateur;
+    return true;
+#else
+    (void)allocateur;
+    return false;
+#endif
+}
+
+/**
+ * \brief Allocateur utilisé par les allocations du thread courant
+ */
+const AllocateurBigBinary *allocateurCourant(void) {
+#if BIGBINARY_ALLOCATEUR_THREAD
+    if (allocateurThread != NULL) return allocateurThread;
+#endif
+    return allocateurGlobalCourant();
+}
+
+/**
+ * \brief Allocateur installé par definirAllocateurThread sur le thread courant
+ * \return NULL si le thread utilise l'allocateur global
+ *
+ * Un code qui change d'allocateur le temps d'un calcul sauvegarde cette
+ * valeur et la remet ensuite, pour ne pas écraser celui de l'appelant.
+ */
+const AllocateurBigBinary *allocateurThreadCourant(void) {
+#if BIGBINARY_ALLOCATEUR_THREAD
+    return allocateurThread;
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * \brief Allocateur global effectif, sans tenir compte de celui du thread
+ */
+const AllocateurBigBinary *allocateurGlobalCourant(void) {
+    return (allocateurGlobal != NULL) ? allocateurGlobal : &allocateurParDefaut;
+}
+
+/**
+ * \brief Refus d'allocation: arrêt propre du programme
+ */
+static void echecAllocation(size_t taille) {
+    fprintf(stderr, "BigBinary: allocation de %zu octets refusée\n", taille);
+    abort();
+}
+
+/**
+ * \brief Allocation qui peut échouer (NULL), pour les appelants capables de rendre l'erreur
+ */
+static inline void *allocationTentee(const AllocateurBigBinary *a, size_t taille, size_t alignement) {
+    return a->allouer(taille, alignement, a->contexte);
+}
+
+/**
+ * \brief Allocation qui ne rend jamais NULL (échec fatal)
+ */
+static inline void *allocation(const AllocateurBigBinary *a, size_t taille, size_t alignement) {
+    void *ptr = a->allouer(taille, alignement, a->contexte);
+    if (ptr == NULL) echecAllocation(taille);
+    return ptr;
+}
+
+static inline void liberation(const AllocateurBigBinary *a, void *ptr, size_t taille, size_t alignement) {
+    if (ptr != NULL) a->liberer(ptr, taille, alignement, a->contexte);
+}
+
+/**
+ * \brief Réallocation; sans fonction reallouer, allocation + copie + libération
+ *
+ * Ne rend jamais NULL (échec fatal, comme allocation).
+ */
+static void *reallocation(const AllocateurBigBinary *a, void *ptr, size_t ancienne,
+                          size_t nouvelle, size_t alignement) {
+    if (a->reallouer != NULL) {
+        void *nouveau = a->reallouer(ptr, ancienne, nouvelle, alignement, a->contexte);
+        if (nouveau == NULL) echecAllocation(nouvelle);
+        return nouveau;
+    }
+
+    void *nouveau = allocation(a, nouvelle, alignement);
+    if (ptr != NULL) {
+        memcpy(nouveau, ptr, ancienne < nouvelle ? ancienne : nouvelle);
+        liberation(a, ptr, ancienne, alignement);
+    }
+    return nouveau;
+}
+
+/*
+ * === AJOUT: Exécuteur de sous-calculs ===
+ *
+ * Même principe que l'allocateur par thread: les très grandes
+ * multiplications confient leurs sous-produits indépendants à
+ * l'exécuteur installé sur le thread (un pool de threads, en pratique).
+ * Sans exécuteur, tout reste séquentiel.
+ */
+
+#if BIGBINARY_ALLOCATEUR_THREAD
+static __thread const ExecuteurBigBinary *executeurThread = NULL;
+#endif
+
+/**
+ * \brief Installe un exécuteur de sous-calculs pour le thread courant
+ * \param executeur Exécuteur à utiliser (NULL pour tout calculer en séquence)
+ * \return false si le compilateur ne permet pas de variable par thread
+ */
+bool definirExecuteurThread(const ExecuteurBigBinary *executeur) {
+#if BIGBINARY_ALLOCATEUR_THREAD
+    executeurThread = executeur;
+    return true;
+#else
+    (void)executeur;
+    return false;
+#endif
+}
+
+/**
+ * \brief Exécuteur de sous-calculs du thread courant (NULL si séquentiel)
+ */
+const ExecuteurBigBinary *executeurCourant(void) {
+#if BIGBINARY_ALLOCATEUR_THREAD
+    return executeurThread;
+#else
+    return NULL;
+#endif
+}
+
+// Tableaux de limbes temporaires (alignés sur une ligne de cache)
+static inline uint64_t *alloueLimbes(size_t n) {
+    return allocation(allocateurCourant(), sizeof(uint64_t) * (n > 0 ? n : 1), BIGBINARY_ALIGNEMENT_LIMBES);
+}
+
+static inline uint64_t *alloueLimbesZero(size_t n) {
+    uint64_t *limbes = alloueLimbes(n);
+    memset(limbes, 0, sizeof(uint64_t) * (n > 0 ? n : 1));
+    return limbes;
+}
+
+static inline void libereLimbes(uint64_t *limbes, size_t n) {
+    liberation(allocateurCourant(), limbes, sizeof(uint64_t) * (n > 0 ? n : 1), BIGBINARY_ALIGNEMENT_LIMBES);
+}
+
+// Tampons de caractères temporaires
+static inline char *alloueTampon(size_t n) {
+    return allocation(allocateurCourant(), n, 1);
+}
+
+static inline void libereTampon(char *tampon, size_t n) {
+    liberation(allocateurCourant(), tampon, n, 1);
+}
+
+/*
+ * === AJOUT: Tableaux partagés (copie sur écriture) ===
+ *
+ * Chaque tableau de bits est précédé, dans le même bloc mémoire, d'un
+ * compteur de références; le champ Partage pointe sur ce compteur (début
+ * du bloc). copieBigBinary() ne fait qu'incrémenter le compteur, et les
+ * fonctions qui modifient un nombre en place appellent rendreUnique()
+ * avant d'écrire: la copie réelle n'a lieu que si le tableau est partagé.
+ * Une vue (Partage == NULL) ne possède pas son tableau: elle n'est jamais
+ * libérée et elle est copiée à la première écriture.
+ */
+
+// En-tête du bloc: compteur, taille et origine, aligné comme n'importe quel type
+typedef union {
+    struct {
+        size_t compteur;                        // Nombre de BigBinary qui partagent le tableau
+        size_t octets;                          // Taille du bloc (en-tête compris)
+        const AllocateurBigBinary *allocateur;  // Allocateur à qui rendre le bloc
+    } info;
+    long double alignement;
+} EnTeteCases;
+
+// Alignement requis par l'en-tête (pas sa taille: malloc suffit, sans sur-allocation)
+#define ALIGNEMENT_CASES offsetof(struct { char c; EnTeteCases e; }, e)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LIT_REFS(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define INCREMENTE_REFS(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+#define DECREMENTE_REFS(p) __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+#else
+#define LIT_REFS(p)        (*(p))
+#define INCREMENTE_REFS(p) (++*(p))
+#define DECREMENTE_REFS(p) (--*(p))
+#endif
+
+/**
+ * \brief Alloue un tableau de n cases (non initialisées) possédé par nb seul
+ */
+static void allouerCases(BigBinary *nb, int n) {
+    const AllocateurBigBinary *allocateur = allocateurCourant();
+    size_t octets = sizeof(EnTeteCases) + sizeof(int) * (size_t)(n > 0 ? n : 1);
+    EnTeteCases *bloc = allocation(allocateur, octets, ALIGNEMENT_CASES);
+    bloc->info.compteur = 1;
+    bloc->info.octets = octets;
+    bloc->info.allocateur = allocateur;
+    nb->Partage = &bloc->info.compteur;
+    nb->Tdigits = (int *)(bloc + 1);
+}
+
+/**
+ * \brief Rend la référence de nb sur son tableau (libéré s'il n'est plus partagé)
+ */
+static void relacherCases(BigBinary *nb) {
+    if (nb->Partage != NULL && DECREMENTE_REFS(nb->Partage) == 0) {
+        EnTeteCases *bloc = (EnTeteCases *)nb->Partage;
+        liberation(bloc->info.allocateur, bloc, bloc->info.octets, ALIGNEMENT_CASES);
+    }
+    nb->Partage = NULL;
+    nb->Tdigits = NULL;
+}
+
+/**
+ * \brief Vrai si nb peut écrire dans son tableau sans gêner personne
+ */
+static inline bool casesUniques(const BigBinary *nb) {
+    return nb->Partage != NULL && LIT_REFS(nb->Partage) == 1;
+}
+
+/**
+ * \brief Donne à nb un tableau privé de n cases, en conservant ses min(n, Taille) premières
+ *
+ * Si nb possède seul son tableau et qu'il commence au début du bloc, un
+ * simple realloc suffit; sinon un nouveau tableau est alloué et rempli.
+ */
+static void redimensionnerCases(BigBinary *nb, int n) {
+    if (casesUniques(nb) && nb->Tdigits == (int *)((EnTeteCases *)nb->Partage + 1)) {
+        EnTeteCases *bloc = (EnTeteCases *)nb->Partage;
+        const AllocateurBigBinary *allocateur = bloc->info.allocateur;
+        size_t octets = sizeof(EnTeteCases) + sizeof(int) * (size_t)(n > 0 ? n : 1);
+        bloc = reallocation(allocateur, bloc, bloc->info.octets, octets, ALIGNEMENT_CASES);
+        bloc->info.octets = octets;
+        nb->Partage = &bloc->info.compteur;
+        nb->Tdigits = (int *)(bloc + 1);
+        return;
+    }
+
+    BigBinary nouveau;
+    allouerCases(&nouveau, n);
+    int garde = (nb->Taille < n) ? nb->Taille : n;
+    if (garde > 0) memcpy(nouveau.Tdigits, nb->Tdigits, sizeof(int) * (size_t)garde);
+    relacherCases(nb);
+    nb->Partage = nouveau.Partage;
+    nb->Tdigits = nouveau.Tdigits;
+}
+
+/**
+ * \brief Remet nb à zéro (un bit nul), sans écrire dans un tableau partagé
+ */
+static void remettreAZero(BigBinary *nb) {
+    if (!casesUniques(nb)) {
+        relacherCases(nb);
+        allouerCases(nb, 1);
+    }
+    nb->Signe = 0;
+    nb->Taille = 1;
+    nb->Tdigits[0] = 0;
+}
+
 /**
  * \brief Initialise un BigBinary vide avec tous les bits à zéro
  * \param taille Nombre de bits à allouer
@@ -43,7 +420,7 @@ BigBinary initBigBinary(int taille, int signe) {
     BigBinary nb;
     nb.Taille = taille;              // Nombre de bits significatifs
     nb.Signe = signe;                // +1 (positif), -1 (négatif), 0 (nul)
-    nb.Tdigits = malloc(sizeof(int) * taille);  // Allocation dynamique
+    allouerCases(&nb, taille);       // Allocation dynamique (tableau non partagé)
 
     // Initialiser tous les bits à 0
     for (int i = 0; i < taille; ++i) {
@@ -52,6 +429,85 @@ BigBinary initBigBinary(int taille, int signe) {
     return nb;
 }
 
+/**
+ * \brief Convertit un texte '0'/'1' en bits, en ignorant les autres caractères
+ * \param dest Tableau de sortie (au moins n cases)
+ * \param src Texte à convertir
+ * \param n Nombre de caractères de src
+ * \return Nombre de bits écrits dans dest
+ *
+ * === AJOUT: Lecture vectorisée ===
+ *
+ * Le texte est traité par blocs de 32 caractères. Un bloc est validé
+ * d'un seul coup: après soustraction de '0', chaque octet doit valoir
+ * 0 ou 1, ce qui se teste avec une comparaison vectorielle et un
+ * movemask (SSE2). Un bloc valide est ensuite élargi octet -> int et
+ * stocké sans aucune branche. Seuls les blocs contenant d'autres
+ * caractères (espaces, séparateurs) passent par la boucle scalaire.
+ * Sans SSE2, le même test est fait 8 caractères à la fois sur un mot
+ * de 64 bits.
+ */
+static int texteVersBits(int *dest, const char *src, size_t n) {
+    size_t i = 0;
+    int k = 0;
+
+#if defined(__SSE2__)
+    const __m128i zeroAscii = _mm_set1_epi8('0');
+    const __m128i pasUn = _mm_set1_epi8((char)0xFE);
+    const __m128i nul = _mm_setzero_si128();
+
+    for (; i + 32 <= n; i += 32) {
+        __m128i a = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(src + i)), zeroAscii);
+        __m128i b = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(src + i + 16)), zeroAscii);
+
+        // Octet valide <=> (c - '0') & ~1 == 0
+        uint32_t masque = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(a, pasUn), nul)) |
+                          ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(b, pasUn), nul)) << 16);
+
+        if (masque != 0xFFFFFFFFu) {
+            // Bloc avec des caractères à ignorer: traitement scalaire
+            for (size_t j = i; j < i + 32; ++j) {
+                if (src[j] == '0' || src[j] == '1') dest[k++] = src[j] - '0';
+            }
+            continue;
+        }
+
+        // Élargissement 8 -> 16 -> 32 bits, 4 entiers par stockage
+        __m128i blocs[2] = {a, b};
+        for (int v = 0; v < 2; ++v) {
+            __m128i bas = _mm_unpacklo_epi8(blocs[v], nul);
+            __m128i haut = _mm_unpackhi_epi8(blocs[v], nul);
+            _mm_storeu_si128((__m128i *)(dest + k),      _mm_unpacklo_epi16(bas, nul));
+            _mm_storeu_si128((__m128i *)(dest + k + 4),  _mm_unpackhi_epi16(bas, nul));
+            _mm_storeu_si128((__m128i *)(dest + k + 8),  _mm_unpacklo_epi16(haut, nul));
+            _mm_storeu_si128((__m128i *)(dest + k + 12), _mm_unpackhi_epi16(haut, nul));
+            k += 16;
+        }
+    }
+#else
+    for (; i + 8 <= n; i += 8) {
+        uint64_t mot;
+        memcpy(&mot, src + i, 8);
+
+        // Chaque octet XOR '0' doit valoir 0 ou 1
+        if (((mot ^ 0x3030303030303030ULL) & 0xFEFEFEFEFEFEFEFEULL) == 0) {
+            for (int j = 0; j < 8; ++j) dest[k + j] = src[i + j] - '0';
+            k += 8;
+        } else {
+            for (size_t j = i; j < i + 8; ++j) {
+                if (src[j] == '0' || src[j] == '1') dest[k++] = src[j] - '0';
+            }
+        }
+    }
+#endif
+
+    // Fin du texte (moins d'un bloc)
+    for (; i < n; ++i) {
+        if (src[i] == '0' || src[i] == '1') dest[k++] = src[i] - '0';
+    }
+    return k;
+}
+
 /**
  * \brief Crée un BigBinary depuis une chaîne de caractères binaire
  * \param chaîne Chaîne contenant uniquement des caractères '0' et '1'
@@ -60,50 +516,28 @@ BigBinary initBigBinary(int taille, int signe) {
  * === Phase 1, §6.5: Initialiser un "BigBinary" ===
  *
  * Algorithme:
- * 1. Compter le nombre de bits valides dans la chaîne
- * 2. Allouer le tableau de bits
- * 3. Remplir le tableau en convertissant les caractères en entiers
- * 4. Détecter si tous les bits sont à 0 (dans ce cas, signe = 0)
+ * 1. Allouer un tableau de la taille de la chaîne (majorant du nombre de bits)
+ * 2. Convertir les caractères '0'/'1' en une seule passe vectorisée
+ *    (les autres caractères sont ignorés)
+ * 3. Normaliser: supprimer les zéros de tête, signe = 0 si tout est nul
  *
  * Stockage: Tdigits[0] = MSB (bit de poids fort), Tdigits[Taille-1] = LSB
  */
 BigBinary creerBigBinaryDepuisChaine(const char *chaine) {
     BigBinary nb;
-    int n = strlen(chaine);
-    nb.Taille = 0;
-
-    // Étape 1: Compter uniquement les caractères valides ('0' ou '1')
-    // On ignore les autres caractères s'il y en a
-    for (int i = 0; i < n; ++i) {
-        if (chaine[i] == '0' || chaine[i] == '1') {
-            nb.Taille++;
-        }
-    }
+    size_t n = strlen(chaine);
 
-    // Étape 2: Allouer le tableau de bits
-    nb.Tdigits = malloc(sizeof(int) * nb.Taille);
+    // Étape 1: Allouer au plus un bit par caractère
+    allouerCases(&nb, n > 0 ? (int)n : 1);
     nb.Signe = +1;  // Par défaut, on suppose positif
 
-    // Variables pour le remplissage
-    int index = 0;      // Position actuelle dans le tableau de sortie
-    int tousZeros = 1;  // Flag pour détecter si tous les bits sont à 0
-
-    // Étape 3: Remplir le tableau bit par bit
-    for (int i = 0; i < n; ++i) {
-        if (chaine[i] == '0' || chaine[i] == '1') {
-            // Convertir le caractère '0' ou '1' en entier 0 ou 1
-            nb.Tdigits[index] = chaine[i] - '0';
-
-            // Si on trouve un bit à 1, alors ce n'est pas tous des zéros
-            if (nb.Tdigits[index] == 1) {
-                tousZeros = 0;
-            }
-            index++;
-        }
-    }
+    // Étape 2: Conversion texte -> bits
+    nb.Taille = texteVersBits(nb.Tdigits, chaine, n);
 
-    // Étape 4: Si tous les bits sont à 0, le nombre est nul (signe = 0)
-    if (tousZeros) nb.Signe = 0;
+    // Étape 3: Supprimer les zéros de tête ("0011" -> "11") pour que
+    // Taille soit exactement le nombre de bits significatifs; un nombre
+    // sans aucun bit à 1 devient nul (signe = 0)
+    normaliser(&nb);
 
     return nb;
 }
@@ -132,7 +566,7 @@ BigBinary creerBigBinaryDepuisDecimal(long long nombre) {
     if (nombre == 0) {
         nb.Taille = 1;           // 1 bit suffisant pour représenter 0
         nb.Signe = 0;            // Signe nul pour représenter zéro
-        nb.Tdigits = malloc(sizeof(int));
+        allouerCases(&nb, 1);
         nb.Tdigits[0] = 0;       // Le bit unique est à 0
         return nb;
     }
@@ -168,7 +602,7 @@ BigBinary creerBigBinaryDepuisDecimal(long long nombre) {
     // Allocation du tableau
     nb.Taille = bits_needed;
     nb.Signe = signe;
-    nb.Tdigits = malloc(sizeof(int) * bits_needed);
+    allouerCases(&nb, bits_needed);
 
     // Remplissage de droite à gauche (du LSB vers le MSB)
     // On prend le reste de la division par 2 (bit de poids faible)
@@ -191,11 +625,59 @@ BigBinary creerZero() {
     BigBinary nb;
     nb.Taille = 1;           // Un seul bit suffit pour zéro
     nb.Signe = 0;            // Signe nul = nombre égal à zéro
-    nb.Tdigits = malloc(sizeof(int));
+    allouerCases(&nb, 1);
     nb.Tdigits[0] = 0;       // Bit unique = 0
     return nb;
 }
 
+/**
+ * \brief Écrit les bits d'un tableau sous forme de caractères '0'/'1'
+ * \param dest Zone de sortie (n caractères, sans '\0')
+ * \param bits Bits à écrire
+ * \param n Nombre de bits
+ *
+ * Avec SSE2, 16 entiers sont resserrés en 16 octets (deux "pack")
+ * puis décalés de '0' en une seule addition.
+ */
+static void bitsVersTexte(char *dest, const int *bits, int n) {
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128i zeroAscii = _mm_set1_epi8('0');
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(bits + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(bits + i + 4));
+        __m128i c = _mm_loadu_si128((const __m128i *)(bits + i + 8));
+        __m128i d = _mm_loadu_si128((const __m128i *)(bits + i + 12));
+        __m128i octets = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_add_epi8(octets, zeroAscii));
+    }
+#endif
+    for (; i < n; ++i) {
+        dest[i] = (char)('0' + bits[i]);
+    }
+}
+
+/**
+ * \brief Convertit un BigBinary en chaîne binaire
+ * \param nb BigBinary à convertir
+ * \return Chaîne allouée (à libérer avec free), avec '-' si négatif
+ */
+char *BigBinaryVersChaine(BigBinary nb) {
+    if (nb.Signe == 0 || nb.Taille == 0) {
+        char *zero = malloc(2);
+        zero[0] = '0';
+        zero[1] = '\0';
+        return zero;
+    }
+
+    char *resultat = malloc(nb.Taille + 2);
+    int pos = 0;
+    if (nb.Signe == -1) resultat[pos++] = '-';
+    bitsVersTexte(resultat + pos, nb.Tdigits, nb.Taille);
+    resultat[pos + nb.Taille] = '\0';
+    return resultat;
+}
+
 /**
  * \brief Affiche un BigBinary en format binaire
  * \param nb BigBinary à afficher
@@ -204,22 +686,28 @@ BigBinary creerZero() {
  *
  * Affiche d'abord le signe si négatif, puis tous les bits.
  * Si le nombre est nul (signe = 0), affiche simplement "0".
+ *
+ * Le texte complet (signe, bits, retour à la ligne) est préparé dans un
+ * seul tampon puis écrit avec un unique fwrite, au lieu d'un printf
+ * par bit.
  */
 void afficheBigBinary(BigBinary nb) {
-    // Afficher le signe moins pour les nombres négatifs
-    if (nb.Signe == -1) printf("-");
-
     // Cas spécial: nombre nul ou taille nulle
     if (nb.Signe == 0 || nb.Taille == 0) {
         printf("0\n");
         return;
     }
 
-    // Afficher chaque bit du MSB (index 0) au LSB (index Taille-1)
-    for (int i = 0; i < nb.Taille; ++i) {
-        printf("%d", nb.Tdigits[i]);
-    }
-    printf("\n");
+    // Signe éventuel + bits + '\n'
+    char *tampon = alloueTampon((size_t)nb.Taille + 2);
+    int pos = 0;
+    if (nb.Signe == -1) tampon[pos++] = '-';
+    bitsVersTexte(tampon + pos, nb.Tdigits, nb.Taille);
+    pos += nb.Taille;
+    tampon[pos++] = '\n';
+
+    fwrite(tampon, 1, pos, stdout);
+    libereTampon(tampon, (size_t)nb.Taille + 2);
 }
 
 /**
@@ -230,43 +718,72 @@ void afficheBigBinary(BigBinary nb) {
  *
  * Important: Cette fonction doit être appelée pour chaque BigBinary
  * créé avec malloc pour éviter les fuites de mémoire.
- * On libère le tableau de bits et on met les champs à zéro.
+ * On rend la référence sur le tableau de bits (libéré quand plus aucune
+ * copie ne le partage) et on met les champs à zéro. Sans effet sur une vue.
  */
 void libereBigBinary(BigBinary *nb) {
-    // Vérifier si le pointeur est déjà NULL (double free protection)
-    if (nb->Tdigits != NULL) {
-        free(nb->Tdigits);     // Libérer la mémoire du tableau
-        nb->Tdigits = NULL;    // Mettre à NULL pour éviter les accès invalides
-    }
+    // relacherCases met les pointeurs à NULL (protection double free)
+    relacherCases(nb);
     nb->Taille = 0;            // Plus de bits
     nb->Signe = 0;             // Signe nul
 }
 
 /**
- * \brief Crée une copie indépendante d'un BigBinary
+ * \brief Crée une copie d'un BigBinary
  * \param nb BigBinary à copier
- * \return Une copie.deep du BigBinary
+ * \return Une copie du BigBinary (à libérer avec libereBigBinary)
  *
  * Utile quand on ne veut pas modifier l'original.
- * Alloue une nouvelle mémoire et copie tous les bits.
+ * Le tableau de bits est partagé (copie sur écriture): la copie ne coûte
+ * qu'un incrément de compteur, et les bits ne sont dupliqués que si l'un
+ * des deux nombres est modifié en place. Une vue est copiée réellement.
  */
 BigBinary copieBigBinary(BigBinary nb) {
-    BigBinary copie;
-
-    // Copier les métadonnées
-    copie.Taille = nb.Taille;
-    copie.Signe = nb.Signe;
-
-    // Allouer nouvelle mémoire pour les bits
-    copie.Tdigits = malloc(sizeof(int) * nb.Taille);
+    BigBinary copie = nb;
 
-    // Copier chaque bit un par un
-    for (int i = 0; i < nb.Taille; ++i) {
-        copie.Tdigits[i] = nb.Tdigits[i];
+    if (nb.Partage != NULL) {
+        INCREMENTE_REFS(nb.Partage);
+        return copie;
     }
+
+    // Vue: allouer nouvelle mémoire et copier tous les bits
+    allouerCases(&copie, nb.Taille);
+    memcpy(copie.Tdigits, nb.Tdigits, sizeof(int) * (size_t)nb.Taille);
     return copie;
 }
 
+/**
+ * \brief Rend le tableau de nb modifiable en place
+ * \param nb BigBinary qui va être modifié
+ *
+ * Si le tableau est partagé avec une copie (ou si nb est une vue), les
+ * bits sont dupliqués dans un tableau privé. À appeler avant d'écrire
+ * directement dans nb->Tdigits; les fonctions de la bibliothèque qui
+ * modifient en place le font déjà.
+ */
+void rendreUnique(BigBinary *nb) {
+    if (!casesUniques(nb)) redimensionnerCases(nb, nb->Taille);
+}
+
+/**
+ * \brief Transfère le contenu d'un BigBinary (déplacement)
+ * \param source BigBinary à vider
+ * \return Le nombre qui était dans source, avec son tableau
+ *
+ * Aucune copie ni allocation: source est laissé vide (comme après
+ * libereBigBinary) et ne doit plus être utilisé, sauf pour être libéré
+ * ou réaffecté. Sert surtout à passer un nombre aux variantes _consomme.
+ * Exemple: r = PGCD_consomme(deplacer(&a), deplacer(&b));
+ */
+BigBinary deplacer(BigBinary *source) {
+    BigBinary nb = *source;
+    source->Tdigits = NULL;
+    source->Partage = NULL;
+    source->Taille = 0;
+    source->Signe = 0;
+    return nb;
+}
+
 /**
  * \brief Supprime les zéros de tête (normalise le BigBinary)
  * \param nb Pointeur vers le BigBinary à normaliser
@@ -295,28 +812,30 @@ void normaliser(BigBinary *nb) {
 
     // === CAS: TOUS LES BITS SONT ZÉRO ===
     if (premierePos == nb->Taille) {
-        nb->Signe = 0;           // Le nombre est nul
-        nb->Taille = 1;          // Réduire à un seul bit
-        nb->Tdigits[0] = 0;      // Ce bit est 0
+        remettreAZero(nb);       // Un seul bit à 0, signe nul
         return;
     }
 
     // === CAS: IL Y A DES ZÉROS DE TÊTE À SUPPRIMER ===
-    if (premierePos > 0) {
+    if (premierePos > 0 && casesUniques(nb)) {
+        // Tableau non partagé: ramener les bits valides au début, sans allocation
+        nb->Taille -= premierePos;
+        memmove(nb->Tdigits, nb->Tdigits + premierePos, sizeof(int) * (size_t)nb->Taille);
+    } else if (premierePos > 0) {
         // Calculer la nouvelle taille (taille originale - zéros de tête)
         int nouvelleTaille = nb->Taille - premierePos;
 
         // Allouer nouveau tableau de la bonne taille
-        int *nouveauTableau = malloc(sizeof(int) * nouvelleTaille);
+        BigBinary nouveau;
+        allouerCases(&nouveau, nouvelleTaille);
 
         // Copier les bits valides (sans les zéros de tête)
-        for (int i = 0; i < nouvelleTaille; ++i) {
-            nouveauTableau[i] = nb->Tdigits[premierePos + i];
-        }
+        memcpy(nouveau.Tdigits, nb->Tdigits + premierePos, sizeof(int) * (size_t)nouvelleTaille);
 
-        // Libérer l'ancien tableau et remplacer par le nouveau
-        free(nb->Tdigits);
-        nb->Tdigits = nouveauTableau;
+        // Rendre l'ancien tableau et remplacer par le nouveau
+        relacherCases(nb);
+        nb->Tdigits = nouveau.Tdigits;
+        nb->Partage = nouveau.Partage;
         nb->Taille = nouvelleTaille;
     }
 }
@@ -326,78 +845,81 @@ void normaliser(BigBinary *nb) {
 // ============================================================================
 
 /**
- * \brief Compare si deux BigBinary sont égaux
+ * \brief Compare les magnitudes |A| et |B| en une seule passe
  * \param A Premier BigBinary
  * \param B Deuxième BigBinary
- * \return true si A == B, false sinon
+ * \return -1 si |A| < |B|, 0 si |A| == |B|, +1 si |A| > |B|
  *
- * === Phase 1, §5.1: Fonctions de comparaison ===
+ * === AJOUT: Comparaison trois-voies ===
+ *
+ * Les nombres étant normalisés, Taille est exactement le nombre de bits
+ * significatifs: deux nombres de tailles différentes sont départagés
+ * immédiatement, sans lire un seul bit.
  *
- * Algorithme de comparaison:
- * 1. Si les signes sont différents -> pas égaux
- * 2. Si les deux sont nuls -> égaux
- * 3. Si les tailles sont différentes -> pas égaux
- * 4. Comparer bit par bit (du MSB au LSB)
+ * À taille égale, on compare les tableaux depuis le MSB avec memcmp.
+ * Chaque case vaut 0 ou 1, donc le premier octet différent trouvé par
+ * memcmp est celui qui contient ce bit: son signe donne directement
+ * l'ordre des deux nombres, quel que soit l'endianness.
  */
-bool Egal(BigBinary A, BigBinary B) {
-    // Règle 1: Signes différents -> pas égaux
-    if (A.Signe != B.Signe) return false;
+int ComparerMagnitude(BigBinary A, BigBinary B) {
+    // Nombre de bits significatifs (0 pour un nombre nul)
+    int tailleA = (A.Signe == 0) ? 0 : A.Taille;
+    int tailleB = (B.Signe == 0) ? 0 : B.Taille;
+
+    // Un nombre avec plus de bits est toujours plus grand
+    // Ex: 1100 (4 bits, 12) > 101 (3 bits, 5)
+    if (tailleA != tailleB) return (tailleA < tailleB) ? -1 : +1;
+    if (tailleA == 0) return 0;  // Deux zéros
 
-    // Règle 2: Deux zéros sont toujours égaux
-    if (A.Signe == 0 && B.Signe == 0) return true;
+    // Même nombre de bits: un seul balayage du MSB vers le LSB
+    int cmp = memcmp(A.Tdigits, B.Tdigits, sizeof(int) * tailleA);
+    return (cmp > 0) - (cmp < 0);
+}
 
-    // Règle 3: Tailles différentes -> pas égaux
-    // (ex: 101 (3 bits) != 1101 (4 bits))
-    if (A.Taille != B.Taille) return false;
+/**
+ * \brief Compare deux BigBinary signés en une seule passe
+ * \param A Premier BigBinary
+ * \param B Deuxième BigBinary
+ * \return -1 si A < B, 0 si A == B, +1 si A > B
+ *
+ * === Phase 1, §5.1: Fonctions de comparaison ===
+ *
+ * 1. Signes différents -> l'ordre des signes (-1 < 0 < +1) décide
+ * 2. Même signe -> comparaison des magnitudes, inversée si négatifs
+ *
+ * Egal, Inferieur et Superieur sont des raccourcis de cette fonction.
+ */
+int Comparer(BigBinary A, BigBinary B) {
+    // Règle 1: signes différents
+    if (A.Signe != B.Signe) return (A.Signe < B.Signe) ? -1 : +1;
 
-    // Règle 4: Comparer chaque bit individuellement
-    for (int i = 0; i < A.Taille; ++i) {
-        if (A.Tdigits[i] != B.Tdigits[i]) return false;
-    }
+    // Règle 2: même signe, on compare les magnitudes
+    int cmp = ComparerMagnitude(A, B);
+    return (A.Signe < 0) ? -cmp : cmp;
+}
 
-    // Tous les bits sont identiques -> égaux
-    return true;
+/**
+ * \brief Compare si deux BigBinary sont égaux
+ * \param A Premier BigBinary
+ * \param B Deuxième BigBinary
+ * \return true si A == B, false sinon
+ *
+ * === Phase 1, §5.1: Egal ===
+ */
+bool Egal(BigBinary A, BigBinary B) {
+    return Comparer(A, B) == 0;
 }
 
 /**
- * \brief Compare si A est inférieur à B (pour nombres positifs)
+ * \brief Compare si A est inférieur à B
  * \param A Premier BigBinary
  * \param B Deuxième BigBinary
  * \return true si A < B, false sinon
  *
  * === Phase 1, §5.1: Inferieur ===
- *
- * Comparaison par magnitude (nombre de bits puis bit par bit):
- * 1. Si A est nul et B positif -> A < B
- * 2. Si A a moins de bits que B -> A < B
- * 3. Si même nombre de bits, comparer du MSB au LSB
- *
- * Note: On suppose des nombres positifs pour la comparaison magnitude
  */
 bool Inferieur(BigBinary A, BigBinary B) {
-    // Cas 1: A nul et B positif -> A < B
-    if (A.Signe == 0 && B.Signe == 1) return true;
-    // Cas inverse: A positif et B nul -> A > B (donc pas <)
-    if (A.Signe == 1 && B.Signe == 0) return false;
-    // Cas 2: Deux zéros sont égaux (ni < ni >)
-    if (A.Signe == 0 && B.Signe == 0) return false;
-
-    // === COMPARAISON PAR NOMBRE DE BITS ===
-    // Un nombre avec plus de bits est toujours plus grand
-    // Ex: 1100 (4 bits, 12) > 101 (3 bits, 5)
-    if (A.Taille < B.Taille) return true;
-    if (A.Taille > B.Taille) return false;
-
-    // === COMPARAISON BIT PAR BIT ===
-    // Même nombre de bits: on compare du MSB au LSB
-    for (int i = 0; i < A.Taille; ++i) {
-        // Le premier bit différent détermine le résultat
-        if (A.Tdigits[i] < B.Tdigits[i]) return true;
-        if (A.Tdigits[i] > B.Tdigits[i]) return false;
-    }
-
-    // Tous les bits sont identiques -> A == B (donc pas <)
-    return false;
+    return Comparer(A, B) < 0;
 }
 
 /**
@@ -408,18 +930,20 @@ bool Inferieur(BigBinary A, BigBinary B) {
  *
  * === Phase 1, §5.1: Superieur ===
  *
- * Simplification logique: A > B si et seulement si
- * A n'est pas inférieur à B ET A n'est pas égal à B
+ * Une seule comparaison (auparavant: Inferieur puis Egal).
  */
 bool Superieur(BigBinary A, BigBinary B) {
-    return !Inferieur(A, B) && !Egal(A, B);
+    return Comparer(A, B) > 0;
 }
 
+// Addition déroulée pour les tailles RSA (voir "TAILLES FIXES")
+static bool additionTailleFixe(BigBinary A, BigBinary B, BigBinary *somme);
+
 /**
- * \brief Additionne deux BigBinary positifs
+ * \brief Additionne les magnitudes de deux BigBinary: |A| + |B|
  * \param A Premier opérande
  * \param B Deuxième opérande
- * \return Résultat de A + B
+ * \return Résultat positif (ou nul) de |A| + |B|
  *
  * === Phase 1, §5.1: Addition (algorithme naïf) ===
  *
@@ -435,7 +959,11 @@ bool Superieur(BigBinary A, BigBinary B) {
  * -----
  *  10000
  */
-BigBinary Addition(BigBinary A, BigBinary B) {
+static BigBinary additionMagnitudes(BigBinary A, BigBinary B) {
+    // === TAILLES RSA: addition déroulée sur les limbes ===
+    BigBinary somme;
+    if (additionTailleFixe(A, B, &somme)) return somme;
+
     // === CALCULER LA TAILLE DU RÉSULTAT ===
     // La somme peut avoir un bit de plus que le plus grand opérande
     // Ex: 111 (7) + 1 (1) = 1000 (8) -> 3 bits + 1 bit = 4 bits
@@ -477,10 +1005,10 @@ BigBinary Addition(BigBinary A, BigBinary B) {
 }
 
 /**
- * \brief Soustrait deux BigBinary positifs (A >= B requis)
- * \param A Premier opérande (doit être >= B)
+ * \brief Soustrait les magnitudes de deux BigBinary: |A| - |B| avec |A| >= |B|
+ * \param A Premier opérande (|A| >= |B| requis, vérifié par l'appelant)
  * \param B Deuxième opérande
- * \return Résultat de A - B
+ * \return Résultat positif (ou nul) de |A| - |B|
  *
  * === Phase 1, §5.1: Soustraction (algorithme naïf) ===
  *
@@ -495,19 +1023,7 @@ BigBinary Addition(BigBinary A, BigBinary B) {
  * -----
  *   0111
  */
-BigBinary Soustraction(BigBinary A, BigBinary B) {
-    // Vérification de sécurité: A doit être >= B
-    // Cette fonction ne supporte pas les nombres négatifs résultants
-    if (Inferieur(A, B)) {
-        printf("Erreur: Soustraction avec A < B non supportée\n");
-        return creerZero();
-    }
-
-    // Si A == B, le résultat est 0
-    if (Egal(A, B)) {
-        return creerZero();
-    }
-
+static BigBinary soustractionMagnitudes(BigBinary A, BigBinary B) {
     // Le résultat a la même taille que A (A > B donc même ou plus de bits)
     BigBinary resultat = initBigBinary(A.Taille, 1);
     int emprunt = 0;  // Emprunt à propagé (0 ou 1)
@@ -544,48 +1060,116 @@ BigBinary Soustraction(BigBinary A, BigBinary B) {
     return resultat;
 }
 
-// ============================================================================
-// ======================= PHASE 2: OPÉRATIONS AVANCÉES =======================
-// ============================================================================
-
 /**
- * \brief Divise un BigBinary par 2 (décalage à droite)
- * \param nb Pointeur vers le BigBinary à diviser
+ * \brief Soustrait en place |B| * 2^k de la magnitude de r
+ * \param r Nombre modifié (doit posséder seul son tableau)
+ * \param B Nombre soustrait
+ * \param k Décalage de B (>= 0)
  *
- * === Phase 2, §6.2: Division par 2 ===
- *
- * En binaire, diviser par 2 est非常简单: on supprime le bit de
- * poids faible (LSB). C'est juste un décalage à droite.
- *
- * Exemple: 1100 (12) / 2 = 110 (6)
- *          1100 >> 1 = 110
- *
- * Note: Si le nombre est impair, le LSB est perdu (division entière)
+ * Précondition: |r| >= |B| * 2^k. Les k bits de poids faible de r ne
+ * changent pas: il suffit de soustraire B du préfixe de r (ses Taille - k
+ * premières cases), sans construire B * 2^k ni de nouveau tableau.
  */
-void divisePar2(BigBinary *nb) {
-    // Ne rien faire si le nombre est nul
-    if (nb->Signe == 0 || nb->Taille == 0) return;
-
-    // === CAS SPÉCIAL: LE NOMBRE EST 1 ===
-    // 1 / 2 = 0, donc le nombre devient nul
-    if (nb->Taille == 1 && nb->Tdigits[0] == 1) {
-        nb->Tdigits[0] = 0;  // Devient 0
-        nb->Signe = 0;       // Signe nul = nombre nul
-        return;
-    }
+static void soustraitDecaleEnPlace(BigBinary *r, BigBinary B, int k) {
+    int *a = r->Tdigits;
+    int fin = r->Taille - k;  // Longueur du préfixe concerné
+    int emprunt = 0;
 
-    // === DÉCALAGE À DROITE ===
-    // Enlever le bit de poids faible = réduire la taille de 1
-    nb->Taille--;
+    for (int i = 0; i < fin; ++i) {
+        // Au-delà de B, seul l'emprunt peut encore changer quelque chose
+        if (i >= B.Taille && emprunt == 0) break;
 
-    // === CAS: LA TAILLE DEVIENT 0 ===
-    // Cela ne devrait pas arriver avec des nombres valides,
-    // mais par sécurité on gère ce cas
-    if (nb->Taille == 0) {
-        nb->Signe = 0;
-        nb->Taille = 1;
-        nb->Tdigits[0] = 0;
+        int bitB = (i < B.Taille) ? B.Tdigits[B.Taille - 1 - i] : 0;
+        int diff = a[fin - 1 - i] - bitB - emprunt;
+        emprunt = (diff < 0);
+        a[fin - 1 - i] = diff + 2 * emprunt;
     }
+
+    // Les zéros de tête sont retirés en place (tableau non partagé)
+    normaliser(r);
+}
+
+/**
+ * \brief Additionne deux BigBinary signés: A + B
+ * \param A Premier opérande
+ * \param B Deuxième opérande
+ * \return Résultat de A + B (avec son signe)
+ *
+ * === AJOUT: Arithmétique signée ===
+ *
+ * Toutes les combinaisons de signes sont traitées ici:
+ * - Même signe: |A| + |B|, avec le signe commun
+ * - Signes opposés: la plus petite magnitude est soustraite de la
+ *   plus grande, et le résultat prend le signe de la plus grande.
+ *   Une seule comparaison de magnitudes suffit.
+ *
+ * Exemple: 101 (5) + -1100 (-12) = -111 (-7)
+ */
+BigBinary Addition(BigBinary A, BigBinary B) {
+    // Élément neutre: 0 + B = B et A + 0 = A
+    if (A.Signe == 0) return copieBigBinary(B);
+    if (B.Signe == 0) return copieBigBinary(A);
+
+    // === MÊME SIGNE: ADDITION DES MAGNITUDES ===
+    if (A.Signe == B.Signe) {
+        BigBinary resultat = additionMagnitudes(A, B);
+        resultat.Signe = A.Signe;
+        return resultat;
+    }
+
+    // === SIGNES OPPOSÉS: DIFFÉRENCE DES MAGNITUDES ===
+    int cmp = ComparerMagnitude(A, B);
+    if (cmp == 0) {
+        return creerZero();  // A + (-A) = 0
+    }
+
+    BigBinary resultat = (cmp > 0) ? soustractionMagnitudes(A, B)
+                                   : soustractionMagnitudes(B, A);
+    resultat.Signe = (cmp > 0) ? A.Signe : B.Signe;
+    return resultat;
+}
+
+/**
+ * \brief Soustrait deux BigBinary signés: A - B
+ * \param A Premier opérande
+ * \param B Deuxième opérande
+ * \return Résultat de A - B (négatif si A < B)
+ *
+ * === AJOUT: Arithmétique signée ===
+ *
+ * A - B = A + (-B): on passe à Addition une copie superficielle de B
+ * dont seul le signe est inversé (le tableau de bits est partagé, rien
+ * n'est alloué ni copié).
+ *
+ * Exemple: 101 (5) - 1100 (12) = -111 (-7)
+ */
+BigBinary Soustraction(BigBinary A, BigBinary B) {
+    BigBinary moinsB = B;
+    moinsB.Signe = -B.Signe;
+    return Addition(A, moinsB);
+}
+
+// ============================================================================
+// ======================= PHASE 2: OPÉRATIONS AVANCÉES =======================
+// ============================================================================
+
+/**
+ * \brief Divise un BigBinary par 2 (décalage à droite)
+ * \param nb Pointeur vers le BigBinary à diviser
+ *
+ * === Phase 2, §6.2: Division par 2 ===
+ *
+ * En binaire, diviser par 2 est非常简单: on supprime le bit de
+ * poids faible (LSB). C'est juste un décalage à droite.
+ *
+ * Exemple: 1100 (12) / 2 = 110 (6)
+ *          1100 >> 1 = 110
+ *
+ * Note: Si le nombre est impair, le LSB est perdu (division entière)
+ */
+void divisePar2(BigBinary *nb) {
+    // Cas particulier du décalage multi-bits avec k = 1
+    decaleDroiteEnPlace(nb, 1);
 }
 
 /**
@@ -602,23 +1186,104 @@ void divisePar2(BigBinary *nb) {
  *          110 << 1 = 1100
  */
 BigBinary multiplePar2(BigBinary nb) {
-    // 0 * 2 = 0
-    if (nb.Signe == 0) return creerZero();
+    // Cas particulier du décalage multi-bits avec k = 1
+    return decaleGauche(nb, 1);
+}
 
-    // Créer un nouveau tableau avec un bit de plus
-    BigBinary resultat = initBigBinary(nb.Taille + 1, nb.Signe);
+/**
+ * \brief Décale un BigBinary de k bits vers la droite (division par 2^k), en place
+ * \param nb Pointeur vers le BigBinary à décaler
+ * \param k Nombre de bits à supprimer (k >= 0)
+ *
+ * === AJOUT: Décalages multi-bits ===
+ *
+ * Comme les bits sont stockés MSB en premier, supprimer les k bits de
+ * poids faible revient simplement à réduire la taille de k: aucun bit
+ * n'est déplacé, le coût est constant quel que soit k.
+ *
+ * Exemple: 110100 (52) >> 2 = 1101 (13)
+ */
+void decaleDroiteEnPlace(BigBinary *nb, int k) {
+    // Rien à faire pour un nombre nul ou un décalage nul
+    if (nb->Signe == 0 || nb->Taille == 0 || k <= 0) return;
 
-    // === COPIE DES BITS EXISTANTS ===
-    // Copier tous les bits de l'original vers le nouveau
-    for (int i = 0; i < nb.Taille; ++i) {
-        resultat.Tdigits[i] = nb.Tdigits[i];
+    // === CAS: TOUS LES BITS SONT SUPPRIMÉS ===
+    if (k >= nb->Taille) {
+        remettreAZero(nb);
+        return;
+    }
+
+    // Les bits restants commencent toujours par le MSB (déjà à 1);
+    // rien n'est écrit, le tableau peut donc rester partagé
+    nb->Taille -= k;
+}
+
+/**
+ * \brief Décale un BigBinary de k bits vers la droite (division par 2^k)
+ * \param nb BigBinary à décaler
+ * \param k Nombre de bits à supprimer (k >= 0)
+ * \return Nouveau BigBinary égal à nb / 2^k
+ *
+ * Version "hors place": le résultat est un préfixe du tableau de nb, qui
+ * est partagé (copie sur écriture) au lieu d'être recopié.
+ */
+BigBinary decaleDroite(BigBinary nb, int k) {
+    if (k < 0) k = 0;
+    if (nb.Signe == 0 || k >= nb.Taille) return creerZero();
+
+    BigBinary resultat = nb;
+    resultat.Taille = nb.Taille - k;
+
+    if (nb.Partage != NULL) {
+        // Le résultat est un préfixe: partager le tableau de nb
+        INCREMENTE_REFS(nb.Partage);
+    } else {
+        // Vue: copie en bloc des bits de poids fort
+        allouerCases(&resultat, resultat.Taille);
+        memcpy(resultat.Tdigits, nb.Tdigits, sizeof(int) * (size_t)resultat.Taille);
     }
+    return resultat;
+}
+
+/**
+ * \brief Décale un BigBinary de k bits vers la gauche (multiplication par 2^k), en place
+ * \param nb Pointeur vers le BigBinary à décaler
+ * \param k Nombre de zéros à ajouter à la fin (k >= 0)
+ *
+ * Le tableau est agrandi une seule fois (realloc) puis les k nouveaux
+ * bits de poids faible sont mis à zéro d'un seul memset.
+ *
+ * Exemple: 1101 (13) << 2 = 110100 (52)
+ */
+void decaleGaucheEnPlace(BigBinary *nb, int k) {
+    // 0 * 2^k = 0
+    if (nb->Signe == 0 || k <= 0) return;
 
-    // === AJOUT DU 0 À LA FIN ===
-    // Ce 0 à la position LSB représente le décalage vers la gauche
-    // Ex: 110 (6) -> 1100 (12): le 0 est ajouté à la fin
-    resultat.Tdigits[nb.Taille] = 0;
+    redimensionnerCases(nb, nb->Taille + k);
+    memset(nb->Tdigits + nb->Taille, 0, sizeof(int) * k);
+    nb->Taille += k;
+}
+
+/**
+ * \brief Décale un BigBinary de k bits vers la gauche (multiplication par 2^k)
+ * \param nb BigBinary à décaler
+ * \param k Nombre de zéros à ajouter à la fin (k >= 0)
+ * \return Nouveau BigBinary égal à nb * 2^k
+ *
+ * Généralise multiplePar2: une allocation, une copie en bloc des bits
+ * existants et un memset pour les k zéros de poids faible.
+ */
+BigBinary decaleGauche(BigBinary nb, int k) {
+    if (nb.Signe == 0) return creerZero();
+    if (k < 0) k = 0;
 
+    BigBinary resultat;
+    resultat.Taille = nb.Taille + k;
+    resultat.Signe = nb.Signe;
+    allouerCases(&resultat, resultat.Taille);
+
+    memcpy(resultat.Tdigits, nb.Tdigits, sizeof(int) * nb.Taille);
+    memset(resultat.Tdigits + nb.Taille, 0, sizeof(int) * k);
     return resultat;
 }
 
@@ -655,6 +1320,337 @@ bool estNul(BigBinary nb) {
     return nb.Signe == 0;
 }
 
+// ============================================================================
+// ====================== AJOUT: OPÉRATIONS BIT À BIT =========================
+// ============================================================================
+
+// Codes des opérations logiques traitées par operationBinaire()
+#define OP_ET     0  // A & B
+#define OP_OU     1  // A | B
+#define OP_XOR    2  // A ^ B
+#define OP_ET_NON 3  // A & ~B
+
+/**
+ * \brief Applique une opération logique bit à bit sur les magnitudes de A et B
+ * \param A Premier opérande
+ * \param B Deuxième opérande
+ * \param op Code de l'opération (OP_ET, OP_OU, OP_XOR, OP_ET_NON)
+ * \return Nouveau BigBinary positif (ou nul) contenant le résultat
+ *
+ * Les deux nombres sont alignés sur leur LSB: le plus court est
+ * complété par des zéros à gauche. Chaque cas a sa propre boucle sans
+ * branche sur des tableaux contigus, que le compilateur peut vectoriser.
+ */
+static BigBinary operationBinaire(BigBinary A, BigBinary B, int op) {
+    int n = (A.Taille > B.Taille) ? A.Taille : B.Taille;
+    BigBinary resultat = initBigBinary(n, 1);
+
+    // Décalages pour aligner A et B sur le LSB du résultat
+    int offA = n - A.Taille;
+    int offB = n - B.Taille;
+    int *r = resultat.Tdigits;
+
+    // Partie haute: seul le plus long des deux a des bits ici
+    // (l'autre vaut 0), on recopie donc directement selon l'opération
+    if (offA > 0 && (op == OP_OU || op == OP_XOR)) {
+        memcpy(r, B.Tdigits, sizeof(int) * offA);
+    }
+    if (offB > 0 && op != OP_ET) {
+        memcpy(r, A.Tdigits, sizeof(int) * offB);
+    }
+
+    // Partie commune: les bits alignés des deux opérandes
+    int debut = (offA > offB) ? offA : offB;
+    const int *a = A.Tdigits - offA;
+    const int *b = B.Tdigits - offB;
+    switch (op) {
+        case OP_ET:
+            for (int i = debut; i < n; ++i) r[i] = a[i] & b[i];
+            break;
+        case OP_OU:
+            for (int i = debut; i < n; ++i) r[i] = a[i] | b[i];
+            break;
+        case OP_XOR:
+            for (int i = debut; i < n; ++i) r[i] = a[i] ^ b[i];
+            break;
+        default:  // OP_ET_NON
+            for (int i = debut; i < n; ++i) r[i] = a[i] & (b[i] ^ 1);
+            break;
+    }
+
+    // Supprimer les zéros de tête (et détecter un résultat nul)
+    normaliser(&resultat);
+    return resultat;
+}
+
+/**
+ * \brief ET logique bit à bit: A & B
+ * \param A Premier opérande
+ * \param B Deuxième opérande
+ * \return Nouveau BigBinary égal à A & B (sur les magnitudes)
+ *
+ * Exemple: 1100 & 1010 = 1000
+ */
+BigBinary EtBinaire(BigBinary A, BigBinary B) {
+    return operationBinaire(A, B, OP_ET);
+}
+
+/**
+ * \brief OU logique bit à bit: A | B
+ * \param A Premier opérande
+ * \param B Deuxième opérande
+ * \return Nouveau BigBinary égal à A | B (sur les magnitudes)
+ *
+ * Exemple: 1100 | 1010 = 1110
+ */
+BigBinary OuBinaire(BigBinary A, BigBinary B) {
+    return operationBinaire(A, B, OP_OU);
+}
+
+/**
+ * \brief OU exclusif bit à bit: A ^ B
+ * \param A Premier opérande
+ * \param B Deuxième opérande
+ * \return Nouveau BigBinary égal à A ^ B (sur les magnitudes)
+ *
+ * Exemple: 1100 ^ 1010 = 110
+ */
+BigBinary OuExclusif(BigBinary A, BigBinary B) {
+    return operationBinaire(A, B, OP_XOR);
+}
+
+/**
+ * \brief ET-NON bit à bit: A & ~B (efface dans A les bits présents dans B)
+ * \param A Premier opérande
+ * \param B Masque des bits à effacer
+ * \return Nouveau BigBinary égal à A & ~B (sur les magnitudes)
+ *
+ * Exemple: 1100 & ~1010 = 100
+ */
+BigBinary EtNonBinaire(BigBinary A, BigBinary B) {
+    return operationBinaire(A, B, OP_ET_NON);
+}
+
+/**
+ * \brief NON logique bit à bit sur la largeur du nombre
+ * \param A Opérande
+ * \return Nouveau BigBinary égal au complément de A sur A.Taille bits
+ *
+ * Un grand entier n'a pas de largeur fixe: le complément est pris sur
+ * les Taille bits significatifs de A, puis normalisé.
+ * Exemple: ~1010 = 101, ~1111 = 0
+ */
+BigBinary NonBinaire(BigBinary A) {
+    if (A.Signe == 0) return creerZero();
+
+    BigBinary resultat = initBigBinary(A.Taille, 1);
+    for (int i = 0; i < A.Taille; ++i) {
+        resultat.Tdigits[i] = A.Tdigits[i] ^ 1;
+    }
+    normaliser(&resultat);
+    return resultat;
+}
+
+/**
+ * \brief Teste le bit de rang i (rang 0 = LSB)
+ * \param nb BigBinary à tester
+ * \param i Rang du bit, compté depuis le bit de poids faible
+ * \return true si le bit vaut 1, false sinon (ou si i est hors du nombre)
+ */
+bool testeBit(BigBinary nb, int i) {
+    if (nb.Signe == 0 || i < 0 || i >= nb.Taille) return false;
+    return nb.Tdigits[nb.Taille - 1 - i] == 1;
+}
+
+/**
+ * \brief Met à 1 le bit de rang i (rang 0 = LSB), en place
+ * \param nb Pointeur vers le BigBinary à modifier
+ * \param i Rang du bit, compté depuis le bit de poids faible
+ *
+ * Si i dépasse la taille actuelle, le nombre est agrandi: les anciens
+ * bits sont déplacés vers la fin du tableau et les nouveaux bits de
+ * tête sont mis à zéro.
+ */
+void metBit(BigBinary *nb, int i) {
+    if (i < 0) return;
+
+    // Un nombre nul n'a aucun bit significatif
+    int ancienneTaille = (nb->Signe == 0) ? 0 : nb->Taille;
+
+    if (i >= ancienneTaille) {
+        int nouvelleTaille = i + 1;
+        int ajout = nouvelleTaille - ancienneTaille;
+        nb->Taille = ancienneTaille;
+        redimensionnerCases(nb, nouvelleTaille);
+        memmove(nb->Tdigits + ajout, nb->Tdigits, sizeof(int) * ancienneTaille);
+        memset(nb->Tdigits, 0, sizeof(int) * ajout);
+        nb->Taille = nouvelleTaille;
+    } else {
+        rendreUnique(nb);
+    }
+
+    nb->Tdigits[nb->Taille - 1 - i] = 1;
+    if (nb->Signe == 0) nb->Signe = 1;
+}
+
+/**
+ * \brief Met à 0 le bit de rang i (rang 0 = LSB), en place
+ * \param nb Pointeur vers le BigBinary à modifier
+ * \param i Rang du bit, compté depuis le bit de poids faible
+ *
+ * Si le MSB est effacé, le nombre est renormalisé.
+ */
+void effaceBit(BigBinary *nb, int i) {
+    if (nb->Signe == 0 || i < 0 || i >= nb->Taille) return;
+
+    rendreUnique(nb);
+    nb->Tdigits[nb->Taille - 1 - i] = 0;
+    if (i == nb->Taille - 1) normaliser(nb);
+}
+
+/**
+ * \brief Compte le nombre de bits à 1 (poids de Hamming)
+ * \param nb BigBinary à analyser
+ * \return Nombre de bits à 1 de la magnitude
+ *
+ * Chaque case vaut 0 ou 1: le poids est donc la somme du tableau,
+ * une réduction que le compilateur vectorise.
+ */
+int poidsHamming(BigBinary nb) {
+    if (nb.Signe == 0) return 0;
+
+    int total = 0;
+    for (int i = 0; i < nb.Taille; ++i) {
+        total += nb.Tdigits[i];
+    }
+    return total;
+}
+
+/**
+ * \brief Renvoie le nombre de bits significatifs (0 pour le nombre nul)
+ * \param nb BigBinary à analyser
+ * \return Position du MSB + 1
+ *
+ * Pour un nombre normalisé, c'est directement Taille.
+ */
+int longueurBits(BigBinary nb) {
+    return (nb.Signe == 0) ? 0 : nb.Taille;
+}
+
+/**
+ * \brief Compte les zéros de poids faible (plus grand k tel que 2^k divise nb)
+ * \param nb BigBinary à analyser
+ * \return Nombre de zéros consécutifs à partir du LSB (0 pour le nombre nul)
+ *
+ * Parcourt le tableau depuis la fin (LSB) jusqu'au premier bit à 1.
+ * Sert à retirer d'un coup tous les facteurs 2 (voir PGCD).
+ */
+int compteZerosFinaux(BigBinary nb) {
+    if (nb.Signe == 0) return 0;
+
+    int k = 0;
+    while (k < nb.Taille && nb.Tdigits[nb.Taille - 1 - k] == 0) {
+        k++;
+    }
+    return k;
+}
+
+// ============================================================================
+// ================== AJOUT: VUES EN LECTURE SEULE (SANS COPIE) ===============
+// ============================================================================
+
+/*
+ * Toutes les opérations reçoivent le BigBinary par valeur et ne font que
+ * lire Tdigits: une structure qui pointe dans le tableau d'un autre nombre
+ * (ou dans un fichier projeté) suffit donc comme opérande.
+ *
+ * Avec le stockage MSB en premier, les bits de poids fort d'un nombre sont
+ * un préfixe du tableau (il suffit de raccourcir Taille) et ses bits de
+ * poids faible un suffixe (il suffit d'avancer le pointeur): couper un
+ * nombre en deux ne demande aucune allocation.
+ */
+
+// Case unique servant de stockage à toutes les vues nulles
+static int caseZeroVue[1] = {0};
+
+/**
+ * \brief Construit une vue normalisée sur des cases existantes
+ * \param cases Bits MSB en premier (non copiés)
+ * \param taille Nombre de cases
+ * \param signe Signe à donner à la vue si elle est non nulle
+ * \return Vue sans zéros de tête (le pointeur est avancé, rien n'est copié)
+ */
+VueBigBinary vueBigBinary(const int *cases, int taille, int signe) {
+    VueBigBinary vue;
+
+    // Sauter les zéros de tête
+    while (taille > 0 && cases[0] == 0) {
+        cases++;
+        taille--;
+    }
+
+    vue.Partage = NULL;  // Une vue ne possède pas son tableau
+    if (taille == 0 || signe == 0) {
+        vue.Tdigits = caseZeroVue;
+        vue.Taille = 1;
+        vue.Signe = 0;
+        return vue;
+    }
+
+    vue.Tdigits = (int *)cases;
+    vue.Taille = taille;
+    vue.Signe = (signe < 0) ? -1 : 1;
+    return vue;
+}
+
+/**
+ * \brief Vue sur les bits de poids fort: |nb| / 2^k, avec le signe de nb
+ * \param nb Nombre observé
+ * \param k Nombre de bits de poids faible ignorés (>= 0)
+ * \return Vue sur le préfixe du tableau (nulle si k >= Taille)
+ */
+VueBigBinary vueBitsHauts(BigBinary nb, int k) {
+    if (nb.Signe == 0 || k >= nb.Taille) return vueBigBinary(NULL, 0, 0);
+    if (k < 0) k = 0;
+    return vueBigBinary(nb.Tdigits, nb.Taille - k, nb.Signe);
+}
+
+/**
+ * \brief Vue sur les bits de poids faible: |nb| mod 2^k, avec le signe de nb
+ * \param nb Nombre observé
+ * \param k Nombre de bits conservés (>= 0)
+ * \return Vue sur le suffixe du tableau, sans ses zéros de tête
+ */
+VueBigBinary vueBitsBas(BigBinary nb, int k) {
+    if (nb.Signe == 0 || k <= 0) return vueBigBinary(NULL, 0, 0);
+    if (k > nb.Taille) k = nb.Taille;
+    return vueBigBinary(nb.Tdigits + nb.Taille - k, k, nb.Signe);
+}
+
+/**
+ * \brief Vue sur la valeur absolue de nb
+ */
+VueBigBinary vueValeurAbsolue(BigBinary nb) {
+    VueBigBinary vue = nb;
+    vue.Partage = NULL;
+    if (vue.Signe != 0) vue.Signe = 1;
+    return vue;
+}
+
+// ============================================================================
+// ============== PHASE 2 (SUITE): MULTIPLICATION, PGCD, MODULO ===============
+// ============================================================================
+
+// Taille (en bits) à partir de laquelle les produits passent par les limbes
+// de 64 bits (voir "MULTIPLICATION ET EXPONENTIATION SUR LES LIMBES")
+#define SEUIL_BITS_LIMBES 128
+
+static BigBinary produitLimbes(BigBinary A, BigBinary B);
+static BigBinary produitModLimbes(BigBinary A, BigBinary B, BigBinary n);
+static BigBinary divisionLimbes(BigBinary A, BigBinary B, BigBinary *quotient);
+static BigBinary pgcdLimbes(BigBinary A, BigBinary B);
+static BigBinary expModMontgomery(BigBinary M, BigBinary e, BigBinary n);
+
 /**
  * \brief Multiplication de deux BigBinary par la méthode égyptienne
  * \param A Premier opérande
@@ -679,6 +1675,9 @@ bool estNul(BigBinary nb) {
  * Étape 2: bit = 1, A = 26, résultat = 13 + 26 = 39
  * Étape 3: bit = 0, A = 52, résultat = 39 (pas d'ajout)
  * Étape 4: bit = 1, A = 104, résultat = 39 + 104 = 143 ✓
+ *
+ * Au-delà de SEUIL_BITS_LIMBES bits, les mêmes produits partiels sont
+ * calculés 64 bits à la fois (noyaux addmul, Karatsuba).
  */
 BigBinary MultiplicationEgyptienne(BigBinary A, BigBinary B) {
     // === CAS SIMPLES ===
@@ -687,12 +1686,19 @@ BigBinary MultiplicationEgyptienne(BigBinary A, BigBinary B) {
         return creerZero();
     }
 
+    // === GRANDS OPÉRANDES: produit sur les limbes ===
+    if (A.Taille >= SEUIL_BITS_LIMBES || B.Taille >= SEUIL_BITS_LIMBES) {
+        return produitLimbes(A, B);
+    }
+
     // Initialiser le résultat à 0
     BigBinary resultat = creerZero();
 
     // Créer une copie de A qu'on va doubler à chaque itération
-    // (multiplicande courant)
+    // (multiplicande courant). On travaille sur |A|: le signe du
+    // produit est appliqué à la fin.
     BigBinary multiplicande = copieBigBinary(A);
+    multiplicande.Signe = 1;
 
     // === BOUCLE PRINCIPALE ===
     // On parcourt B de droite à gauche (du LSB au MSB)
@@ -716,6 +1722,9 @@ BigBinary MultiplicationEgyptienne(BigBinary A, BigBinary B) {
 
     // Libérer le multiplicande temporaire
     libereBigBinary(&multiplicande);
+
+    // Règle des signes: (+)(+) = (-)(-) = +, (+)(-) = (-)(+) = -
+    resultat.Signe = A.Signe * B.Signe;
     return resultat;
 }
 
@@ -760,15 +1769,35 @@ BigBinary MultiplicationEgyptienne(BigBinary A, BigBinary B) {
     9. PGCD(3, 3) = 3 ✓
  */
 BigBinary PGCD(BigBinary A, BigBinary B) {
+    // Copies partagées (copie sur écriture): les originaux ne sont pas modifiés
+    return PGCD_consomme(copieBigBinary(A), copieBigBinary(B));
+}
+
+/**
+ * \brief PGCD qui prend possession de ses arguments
+ * \param A Premier nombre (consommé: ne plus l'utiliser ni le libérer)
+ * \param B Deuxième nombre (consommé)
+ * \return PGCD(A, B), construit dans le tableau de A ou de B
+ *
+ * Même algorithme que PGCD(), sans copie défensive: les décalages se
+ * font directement dans les tableaux reçus. Le résultat est toujours
+ * positif (ou nul): PGCD(-12, 18) = PGCD(-12, -18) = 6.
+ */
+BigBinary PGCD_consomme(BigBinary A, BigBinary B) {
+    // Seules les grandeurs comptent: PGCD(-a, b) = PGCD(a, b)
+    if (!estNul(A)) A.Signe = 1;
+    if (!estNul(B)) B.Signe = 1;
+
     // === CAS TRIVIAUX ===
     // Si A == B, le PGCD est A (ou B)
-    if (Egal(A, B)) {
-        return copieBigBinary(A);
+    if (ComparerMagnitude(A, B) == 0) {
+        libereBigBinary(&B);
+        return A;
     }
 
-    // Créer des copies pour ne pas modifier les originaux
-    BigBinary a = copieBigBinary(A);
-    BigBinary b = copieBigBinary(B);
+    // Les arguments appartiennent à la fonction: on travaille dessus
+    BigBinary a = A;
+    BigBinary b = B;
 
     // PGCD(a, 0) = a et PGCD(0, b) = b
     if (estNul(b)) {
@@ -780,40 +1809,51 @@ BigBinary PGCD(BigBinary A, BigBinary B) {
         return b;
     }
 
+    // === GRANDS OPÉRANDES: mêmes règles, 64 bits à la fois ===
+    if (a.Taille >= SEUIL_BITS_LIMBES || b.Taille >= SEUIL_BITS_LIMBES) {
+        BigBinary resultat = pgcdLimbes(a, b);
+        libereBigBinary(&a);
+        libereBigBinary(&b);
+        return resultat;
+    }
+
     // === ÉLIMINER LES FACTEURS 2 COMMUNS ===
     // Compteur pour se souvenir combien de fois on a divisé par 2
     int facteur2 = 0;
 
-    // Tant que a ET b sont pairs, on divise les deux par 2
-    // Ce sont des facteurs 2 communs qu'on pourra réintégrer à la fin
-    while (estPair(a) && estPair(b)) {
-        divisePar2(&a);  // a = a / 2
-        divisePar2(&b);  // b = b / 2
-        facteur2++;      // Compter les divisions par 2
-    }
+    // Le nombre de facteurs 2 communs est le minimum des zéros de poids
+    // faible de a et b: on les retire tous en un seul décalage
+    int zerosA = compteZerosFinaux(a);
+    int zerosB = compteZerosFinaux(b);
+    facteur2 = (zerosA < zerosB) ? zerosA : zerosB;
+    decaleDroiteEnPlace(&a, facteur2);  // a = a / 2^facteur2
+    decaleDroiteEnPlace(&b, facteur2);  // b = b / 2^facteur2
 
     // === ALGORITHME BINAIRE D'EUCLIDE ===
     // Tant que a != b, appliquer les règles de simplification
-    while (!Egal(a, b)) {
+    // (une seule comparaison par tour sert aussi à choisir a-b ou b-a)
+    int cmp;
+    while ((cmp = ComparerMagnitude(a, b)) != 0) {
         if (estPair(a)) {
             // Règle 3: a pair, b impair -> PGCD(a, b) = PGCD(a/2, b)
-            divisePar2(&a);
+            // (appliquée autant de fois qu'il y a de zéros finaux)
+            decaleDroiteEnPlace(&a, compteZerosFinaux(a));
         } else if (estPair(b)) {
             // Règle 4: a impair, b pair -> PGCD(a, b) = PGCD(a, b/2)
-            divisePar2(&b);
+            decaleDroiteEnPlace(&b, compteZerosFinaux(b));
         } else {
             // Règle 5: Les deux sont impairs
             // PGCD(a, b) = PGCD(|a-b|, min(a, b))
             // Ici a et b sont positifs et a != b, donc |a-b| = max(a,b) - min(a,b)
-            if (Superieur(a, b)) {
+            if (cmp > 0) {
                 // a > b -> PGCD(a, b) = PGCD(a-b, b)
-                BigBinary diff = Soustraction(a, b);
+                BigBinary diff = soustractionMagnitudes(a, b);
                 libereBigBinary(&a);
                 a = diff;
                 divisePar2(&a);  // (a-b) est toujours pair après soustraction!
             } else {
                 // b > a -> PGCD(a, b) = PGCD(a, b-a)
-                BigBinary diff = Soustraction(b, a);
+                BigBinary diff = soustractionMagnitudes(b, a);
                 libereBigBinary(&b);
                 b = diff;
                 divisePar2(&b);  // (b-a) est toujours pair!
@@ -825,11 +1865,7 @@ BigBinary PGCD(BigBinary A, BigBinary B) {
     // On avait divisé a et b par 2, facteur2 fois
     // Donc on doit multiplier le résultat par 2^facteur2
     BigBinary resultat = a;  // a == b à ce stade
-    for (int i = 0; i < facteur2; ++i) {
-        BigBinary temp = multiplePar2(resultat);
-        libereBigBinary(&resultat);
-        resultat = temp;
-    }
+    decaleGaucheEnPlace(&resultat, facteur2);  // Un seul décalage de facteur2 bits
 
     libereBigBinary(&b);
     return resultat;
@@ -877,54 +1913,70 @@ BigBinary PGCD(BigBinary A, BigBinary B) {
 
     Étape 3: 27 < 33? OUI!
     Donc 192 mod 33 = 27 ✓
+
+ * Au-delà de SEUIL_BITS_LIMBES bits, la même réduction est faite 64 bits
+ * à la fois (division de limbes, Knuth algorithme D).
  */
 BigBinary Modulo(BigBinary A, BigBinary B) {
+    // Copie partagée de A: dupliquée seulement à la première soustraction
+    return Modulo_consomme(copieBigBinary(A), B);
+}
+
+/**
+ * \brief Modulo qui prend possession du dividende: A mod B
+ * \param A Dividende (consommé: ne plus l'utiliser ni le libérer)
+ * \param B Diviseur (doit être non nul, seulement lu)
+ * \return A % B, calculé dans le tableau de A
+ *
+ * Chaque étape soustrait 2^k * B directement dans le reste (voir
+ * soustraitDecaleEnPlace): aucune allocation dans la boucle.
+ */
+BigBinary Modulo_consomme(BigBinary A, BigBinary B) {
     // === VÉRIFICATIONS ===
     if (estNul(B)) {
         fprintf(stderr, "Erreur: Division par zéro dans Modulo\n");
+        libereBigBinary(&A);
         return creerZero();
     }
 
     // === CAS SIMPLES ===
+    int cmp = ComparerMagnitude(A, B);
     // Si A < B, alors A mod B = A
-    if (Inferieur(A, B)) {
-        return copieBigBinary(A);
+    if (cmp < 0) {
+        return A;
     }
     // Si A == B, alors A mod B = 0
-    if (Egal(A, B)) {
+    if (cmp == 0) {
+        libereBigBinary(&A);
         return creerZero();
     }
 
-    // Créer une copie de A pour le reste
-    BigBinary reste = copieBigBinary(A);
+    // === GRANDS OPÉRANDES: division sur les limbes ===
+    if (A.Taille >= SEUIL_BITS_LIMBES) {
+        BigBinary reste = divisionLimbes(A, B, NULL);
+        libereBigBinary(&A);
+        return reste;
+    }
+
+    // Le reste est A lui-même (copié ici seulement s'il est partagé)
+    BigBinary reste = A;
+    rendreUnique(&reste);
+    reste.Signe = 1;
 
     // === BOUCLE PRINCIPALE: tant que reste >= B ===
-    while (!Inferieur(reste, B)) {
+    while (ComparerMagnitude(reste, B) >= 0) {
         // Trouver la plus grande puissance de 2 telle que 2^k * B <= reste
-        // On commence avec B et on le double jusqu'à dépasser reste
-        BigBinary B_decale = copieBigBinary(B);
-
-        // Doubler B_decale (= multiplier par 2^k) jusqu'à dépasser reste
-        while (true) {
-            BigBinary B_double = multiplePar2(B_decale);
-
-            // Si 2^(k+1) * B > reste, on s'arrête
-            // B_decale représente maintenant 2^k * B
-            if (Superieur(B_double, reste)) {
-                libereBigBinary(&B_double);
-                break;  // B_decale est la plus grande puissance valide
-            }
+        // 2^k * B a exactement Taille(B) + k bits: on aligne donc B sur le
+        // MSB de reste (k = différence de tailles)
+        int k = reste.Taille - B.Taille;
 
-            // Sinon, continuer avec la prochaine puissance
-            libereBigBinary(&B_decale);
-            B_decale = B_double;
+        // Si 2^k * B dépasse reste (B > préfixe de reste), la bonne puissance est 2^(k-1)
+        if (ComparerMagnitude(B, vueBitsHauts(reste, k)) > 0) {
+            k--;
         }
 
-        // Soustraire 2^k * B du reste
-        BigBinary nouveau_reste = Soustraction(reste, B_decale);
-        libereBigBinary(&reste);
-        libereBigBinary(&B_decale);
-        reste = nouveau_reste;
+        // Soustraire 2^k * B du reste, en place
+        soustraitDecaleEnPlace(&reste, B, k);
     }
 
     return reste;
@@ -957,77 +2009,85 @@ BigBinary Modulo(BigBinary A, BigBinary B) {
 
     Étape 2: reste = 3 < 5, donc on s'arrête
     Résultat: quotient = 4, reste = 3 ✓
+
+ * Au-delà de SEUIL_BITS_LIMBES bits, quotient et reste sont calculés
+ * 64 bits à la fois (division de limbes, Knuth algorithme D).
  */
 DivisionResult DivisionEuclidienne(BigBinary A, BigBinary B) {
+    // Copie partagée de A: dupliquée seulement à la première soustraction
+    return DivisionEuclidienne_consomme(copieBigBinary(A), B);
+}
+
+/**
+ * \brief Division euclidienne qui prend possession du dividende
+ * \param A Dividende (consommé: ne plus l'utiliser ni le libérer)
+ * \param B Diviseur (seulement lu)
+ * \return quotient et reste; le reste est calculé dans le tableau de A
+ *
+ * Le quotient est alloué une seule fois (sa taille est connue dès le
+ * premier décalage) et ses bits sont posés directement.
+ */
+DivisionResult DivisionEuclidienne_consomme(BigBinary A, BigBinary B) {
     DivisionResult result;
 
     // === CAS SPÉCIAUX ===
     if (estNul(B)) {
         fprintf(stderr, "Erreur: Division par zéro dans DivisionEuclidienne\n");
+        libereBigBinary(&A);
         result.quotient = creerZero();
         result.reste = creerZero();
         return result;
     }
 
     // Si A < B: quotient = 0, reste = A
-    if (Inferieur(A, B)) {
+    int cmp = ComparerMagnitude(A, B);
+    if (cmp < 0) {
         result.quotient = creerZero();
-        result.reste = copieBigBinary(A);
+        result.reste = A;
         return result;
     }
 
     // Si A == B: quotient = 1, reste = 0
-    if (Egal(A, B)) {
+    if (cmp == 0) {
+        libereBigBinary(&A);
         result.quotient = creerBigBinaryDepuisChaine("1");
         result.reste = creerZero();
         return result;
     }
 
-    // Initialiser reste = A, quotient = 0
-    BigBinary reste = copieBigBinary(A);
-    BigBinary quotient = creerZero();
-
-    // === BOUCLE PRINCIPALE ===
-    while (!Inferieur(reste, B)) {
-        // Trouver le plus grand k tel que 2^k * B <= reste
-        BigBinary B_decale = copieBigBinary(B);
-        BigBinary puissance2 = creerBigBinaryDepuisChaine("1");  // = 2^0
-
-        // Trouver k maximal tel que 2^k * B <= reste
-        while (true) {
-            BigBinary B_double = multiplePar2(B_decale);
+    // === GRANDS OPÉRANDES: division sur les limbes ===
+    if (A.Taille >= SEUIL_BITS_LIMBES) {
+        result.reste = divisionLimbes(A, B, &result.quotient);
+        libereBigBinary(&A);
+        return result;
+    }
 
-            if (Superieur(B_double, reste)) {
-                // 2^(k+1) * B > reste, donc k est maximal
-                libereBigBinary(&B_double);
-                break;
-            }
+    // Initialiser reste = A (en place)
+    BigBinary reste = A;
+    rendreUnique(&reste);
+    reste.Signe = 1;
 
-            // Continuer: 2^(k+1) * B <= reste
-            libereBigBinary(&B_decale);
-            B_decale = B_double;
+    // Le premier k est le plus grand: le quotient a au plus k + 1 bits
+    int kMax = reste.Taille - B.Taille;
+    BigBinary quotient = initBigBinary(kMax + 1, 1);
 
-            // Mettre à jour la puissance de 2 (2 * 2^k = 2^(k+1))
-            BigBinary p2 = multiplePar2(puissance2);
-            libereBigBinary(&puissance2);
-            puissance2 = p2;
+    // === BOUCLE PRINCIPALE ===
+    while (ComparerMagnitude(reste, B) >= 0) {
+        // Trouver le plus grand k tel que 2^k * B <= reste
+        // (même alignement direct sur le MSB que dans Modulo)
+        int k = reste.Taille - B.Taille;
+        if (ComparerMagnitude(B, vueBitsHauts(reste, k)) > 0) {
+            // 2^k * B > reste, donc k - 1 est maximal
+            k--;
         }
 
-        // Soustraire 2^k * B du reste
-        BigBinary nouveau_reste = Soustraction(reste, B_decale);
-        libereBigBinary(&reste);
-        reste = nouveau_reste;
-
-        // Ajouter 2^k au quotient
-        BigBinary nouveau_quotient = Addition(quotient, puissance2);
-        libereBigBinary(&quotient);
-        quotient = nouveau_quotient;
-
-        // Libérer les temporaires
-        libereBigBinary(&B_decale);
-        libereBigBinary(&puissance2);
+        // Soustraire 2^k * B du reste et ajouter 2^k au quotient
+        // (chaque k est strictement plus petit que le précédent: le bit est libre)
+        soustraitDecaleEnPlace(&reste, B, k);
+        quotient.Tdigits[kMax - k] = 1;
     }
 
+    normaliser(&quotient);
     result.quotient = quotient;
     result.reste = reste;
     return result;
@@ -1043,12 +2103,2764 @@ void libereDivisionResult(DivisionResult *res) {
 }
 
 // ============================================================================
-// ==================== PHASE 2: EXPONENTIATION MODULAIRE =====================
+// =============== AJOUT: OUTILS INTERNES SUR DES MOTS DE 64 BITS =============
 // ============================================================================
 
+/*
+ * Les opérations avec un entier natif travaillent sur des "limbes":
+ * les bits du BigBinary regroupés par paquets de 64 dans des uint64_t,
+ * limbe[0] contenant les 64 bits de poids faible. La conversion coûte
+ * un passage sur les bits, ensuite chaque étape traite 64 bits d'un coup.
+ */
+
 /**
- * \brief Exponentiation modulaire (version avec exposant BigBinary)
- * \param M Base
+ * \brief Compte les zéros de tête d'un mot de 64 bits non nul
+ */
+static inline int zerosTete64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while (!(x & 0x8000000000000000ULL)) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * \brief Produit complet 64 x 64 -> 128 bits
+ * \param a Premier facteur
+ * \param b Deuxième facteur
+ * \param haut Reçoit les 64 bits de poids fort du produit
+ * \return Les 64 bits de poids faible du produit
+ */
+static inline uint64_t mul64(uint64_t a, uint64_t b, uint64_t *haut) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 p = (unsigned __int128)a * b;
+    *haut = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    // Découpage en moitiés de 32 bits (compilateurs sans entier 128 bits)
+    uint64_t aL = a & 0xFFFFFFFFu, aH = a >> 32;
+    uint64_t bL = b & 0xFFFFFFFFu, bH = b >> 32;
+    uint64_t ll = aL * bL, lh = aL * bH, hl = aH * bL, hh = aH * bH;
+    uint64_t milieu = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+    *haut = hh + (lh >> 32) + (hl >> 32) + (milieu >> 32);
+    return (milieu << 32) | (ll & 0xFFFFFFFFu);
+#endif
+}
+
+/**
+ * \brief Division 128 / 64 bits: (haut:bas) / d avec haut < d
+ * \param haut 64 bits de poids fort du dividende (doit être < d)
+ * \param bas 64 bits de poids faible du dividende
+ * \param d Diviseur non nul
+ * \param reste Reçoit le reste
+ * \return Le quotient (tient sur 64 bits car haut < d)
+ */
+static inline uint64_t div128(uint64_t haut, uint64_t bas, uint64_t d, uint64_t *reste) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 n = ((unsigned __int128)haut << 64) | bas;
+    *reste = (uint64_t)(n % d);
+    return (uint64_t)(n / d);
+#else
+    // Division binaire bit à bit (même principe que Modulo)
+    uint64_t q = 0;
+    for (int i = 63; i >= 0; --i) {
+        uint64_t debordement = haut >> 63;
+        haut = (haut << 1) | ((bas >> i) & 1);
+        q <<= 1;
+        if (debordement || haut >= d) {
+            haut -= d;
+            q |= 1;
+        }
+    }
+    *reste = haut;
+    return q;
+#endif
+}
+
+/**
+ * \brief Écrit la magnitude d'un BigBinary sur n limbes fournis (complétés par des zéros)
+ * \param nb BigBinary à convertir, |nb| < 2^(64n)
+ * \param limbes Destination de n limbes, limbe[0] = poids faible
+ * \param n Nombre de limbes de la destination
+ */
+static void chargeLimbes(BigBinary nb, uint64_t *limbes, int n) {
+    int taille = (nb.Signe == 0) ? 0 : nb.Taille;
+    memset(limbes, 0, sizeof(uint64_t) * n);
+
+    // Le bit de rang i (depuis le LSB) est Tdigits[taille - 1 - i]
+    for (int i = 0; i < taille; ++i) {
+        limbes[i >> 6] |= (uint64_t)nb.Tdigits[taille - 1 - i] << (i & 63);
+    }
+}
+
+/**
+ * \brief Regroupe les bits d'un BigBinary en limbes de 64 bits
+ * \param nb BigBinary à convertir (seule la magnitude est lue)
+ * \param nbLimbes Reçoit le nombre de limbes alloués (>= 1)
+ * \return Tableau de limbes, limbe[0] = poids faible (à libérer avec libereLimbes)
+ */
+static uint64_t *versLimbes(BigBinary nb, int *nbLimbes) {
+    int taille = (nb.Signe == 0) ? 0 : nb.Taille;
+    int n = (taille + 63) / 64;
+    if (n == 0) n = 1;
+
+    uint64_t *limbes = alloueLimbes(n);
+    chargeLimbes(nb, limbes, n);
+    *nbLimbes = n;
+    return limbes;
+}
+
+/**
+ * \brief Construit un BigBinary normalisé à partir de limbes de 64 bits
+ * \param limbes Tableau de limbes, limbe[0] = poids faible
+ * \param n Nombre de limbes
+ * \param signe Signe à donner au résultat s'il est non nul
+ * \return Nouveau BigBinary (nul si tous les limbes sont nuls)
+ */
+static BigBinary depuisLimbes(const uint64_t *limbes, int n, int signe) {
+    // Ignorer les limbes nuls de tête
+    while (n > 0 && limbes[n - 1] == 0) n--;
+    if (n == 0) return creerZero();
+
+    // Nombre de bits du limbe de tête
+    int bitsTete = 0;
+    for (uint64_t haut = limbes[n - 1]; haut != 0; haut >>= 1) bitsTete++;
+
+    int taille = (n - 1) * 64 + bitsTete;
+    BigBinary nb = initBigBinary(taille, signe);
+    for (int i = 0; i < taille; ++i) {
+        nb.Tdigits[taille - 1 - i] = (int)((limbes[i >> 6] >> (i & 63)) & 1);
+    }
+    return nb;
+}
+
+/**
+ * \brief Prépare une vue BigBinary d'un entier natif, sans allocation
+ * \param u Valeur à représenter
+ * \param bits Tableau de 64 cases fourni par l'appelant (sur la pile)
+ * \return BigBinary dont Tdigits pointe dans 'bits' (ne pas libérer)
+ */
+static BigBinary vueDepuisU64(uint64_t u, int bits[64]) {
+    BigBinary vue;
+    vue.Partage = NULL;
+    if (u == 0) {
+        bits[0] = 0;
+        vue.Tdigits = bits;
+        vue.Taille = 1;
+        vue.Signe = 0;
+        return vue;
+    }
+
+    int taille = 0;
+    for (uint64_t t = u; t != 0; t >>= 1) taille++;
+    for (int i = 0; i < taille; ++i) {
+        bits[taille - 1 - i] = (int)((u >> i) & 1);
+    }
+    vue.Tdigits = bits;
+    vue.Taille = taille;
+    vue.Signe = 1;
+    return vue;
+}
+
+// ============================================================================
+// ================ AJOUT: ARITHMÉTIQUE INTERNE SUR LES LIMBES ================
+// ============================================================================
+
+/*
+ * Noyaux de calcul sur des tableaux de limbes (poids faible en premier).
+ * Ils servent aux conversions de base et aux opérations qui manipulent
+ * de très grands nombres: chaque opération traite 64 bits à la fois.
+ */
+
+// Nombre de limbes en dessous duquel Karatsuba n'est plus rentable
+#define SEUIL_KARATSUBA 32
+
+// Taille (en limbes) à partir de laquelle les trois sous-produits de
+// Karatsuba sont confiés à l'exécuteur du thread: 2048 limbes = 128 Kbits,
+// soit des sous-produits de plusieurs dizaines de microsecondes
+#define SEUIL_KARATSUBA_PARALLELE 2048
+
+// Corps des noyaux: recopiés dans chaque variante compilée (voir plus bas)
+#if defined(__GNUC__) || defined(__clang__)
+#define TOUJOURS_EN_LIGNE inline __attribute__((always_inline))
+#else
+#define TOUJOURS_EN_LIGNE inline
+#endif
+
+/**
+ * \brief r[0..n) += a[0..n) * b, renvoie la retenue sortante
+ *
+ * Boucle élémentaire de la multiplication scolaire ("addmul").
+ */
+static TOUJOURS_EN_LIGNE uint64_t addmulCorps(uint64_t *r, const uint64_t *a, int n, uint64_t b) {
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t haut;
+        uint64_t bas = mul64(a[i], b, &haut);
+        bas += retenue;
+        haut += (bas < retenue);
+        r[i] += bas;
+        haut += (r[i] < bas);
+        retenue = haut;
+    }
+    return retenue;
+}
+
+// Boucle addmul utilisée par les corps ci-dessous (constante dans chaque variante)
+typedef uint64_t (*FonctionAddmul)(uint64_t *r, const uint64_t *a, int n, uint64_t b);
+
+/**
+ * \brief Multiplication scolaire: r[0..na+nb) = a * b
+ */
+static TOUJOURS_EN_LIGNE void mulBasiqueCorps(uint64_t *r, const uint64_t *a, int na,
+                                              const uint64_t *b, int nb, FonctionAddmul addmul) {
+    memset(r, 0, sizeof(uint64_t) * (na + nb));
+    for (int j = 0; j < nb; ++j) {
+        r[na + j] = addmul(r + j, a, na, b[j]);
+    }
+}
+
+/**
+ * \brief Carré scolaire: r[0..2n) = a * a
+ *
+ * Les produits croisés a[i] * a[j] (i < j) ne sont calculés qu'une fois
+ * puis doublés, et les carrés a[i]^2 ajoutés sur la diagonale: environ
+ * deux fois moins de produits qu'une multiplication.
+ */
+static TOUJOURS_EN_LIGNE void carreCorps(uint64_t *r, const uint64_t *a, int n, FonctionAddmul addmul) {
+    memset(r, 0, sizeof(uint64_t) * 2 * n);
+
+    // Produits croisés: la ligne i commence au rang 2i + 1
+    for (int i = 0; i < n - 1; ++i) {
+        r[n + i] = addmul(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+    }
+
+    // Doubler (décalage d'un bit vers la gauche)
+    uint64_t sortant = 0;
+    for (int i = 0; i < 2 * n; ++i) {
+        uint64_t x = r[i];
+        r[i] = (x << 1) | sortant;
+        sortant = x >> 63;
+    }
+
+    // Ajouter la diagonale
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t haut;
+        uint64_t bas = mul64(a[i], a[i], &haut);
+        bas += retenue;
+        haut += (bas < retenue);
+        r[2 * i] += bas;
+        haut += (r[2 * i] < bas);
+        r[2 * i + 1] += haut;
+        retenue = (r[2 * i + 1] < haut);
+    }
+}
+
+/**
+ * \brief r[0..n) += a[0..n), renvoie la retenue sortante (0 ou 1)
+ */
+static uint64_t ajouteLimbes(uint64_t *r, const uint64_t *a, int n) {
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t s = r[i] + retenue;
+        retenue = (s < retenue);
+        r[i] = s + a[i];
+        retenue += (r[i] < s);
+    }
+    return retenue;
+}
+
+#if BIGBINARY_X86
+/**
+ * \brief r[0..n) += a[0..n) avec l'instruction ADC (toujours présente en x86-64)
+ */
+static uint64_t ajouteLimbesAdc(uint64_t *r, const uint64_t *a, int n) {
+    unsigned char retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        unsigned long long s;
+        retenue = _addcarry_u64(retenue, r[i], a[i], &s);
+        r[i] = s;
+    }
+    return retenue;
+}
+#endif
+
+/**
+ * \brief r[0..n) -= a[0..n), renvoie l'emprunt sortant (0 ou 1)
+ */
+static uint64_t retireLimbes(uint64_t *r, const uint64_t *a, int n) {
+    uint64_t emprunt = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t x = r[i];
+        uint64_t d = x - a[i];
+        uint64_t e = (d > x);
+        r[i] = d - emprunt;
+        e += (r[i] > d);
+        emprunt = e;
+    }
+    return emprunt;
+}
+
+/**
+ * \brief Propage une retenue dans r[0..n) à partir du rang 0
+ */
+static void propageRetenue(uint64_t *r, int n, uint64_t retenue) {
+    for (int i = 0; i < n && retenue; ++i) {
+        r[i] += retenue;
+        retenue = (r[i] < retenue);
+    }
+}
+
+/**
+ * \brief Propage un emprunt dans r[0..n) à partir du rang 0
+ */
+static void propageEmprunt(uint64_t *r, int n, uint64_t emprunt) {
+    for (int i = 0; i < n && emprunt; ++i) {
+        uint64_t x = r[i];
+        r[i] = x - emprunt;
+        emprunt = (r[i] > x);
+    }
+}
+
+/**
+ * \brief Compare a[0..n) et b[0..n) (-1, 0 ou 1)
+ */
+static int compareLimbes(const uint64_t *a, const uint64_t *b, int n) {
+    for (int i = n - 1; i >= 0; --i) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * \brief Réduction de Montgomery: r[0..k) = t * 2^(-64k) mod n
+ * \param r Résultat (< n)
+ * \param t Produit de 2k limbes (< n * 2^(64k)), modifié
+ * \param n Module impair de k limbes
+ * \param nInverse -n^-1 mod 2^64
+ *
+ * Chaque tour annule le limbe t[i] en ajoutant m * n (une ligne addmul);
+ * la retenue de la ligne est gardée à part au lieu d'être propagée.
+ */
+static TOUJOURS_EN_LIGNE void redcCorps(uint64_t *r, uint64_t *t, const uint64_t *n,
+                                        uint64_t nInverse, int k, FonctionAddmul addmul) {
+    uint64_t sup = 0;
+    for (int i = 0; i < k; ++i) {
+        uint64_t c = addmul(t + i, n, k, t[i] * nInverse);
+        uint64_t x = t[i + k] + c;
+        uint64_t c1 = (x < c);
+        t[i + k] = x + sup;
+        c1 += (t[i + k] < sup);
+        sup = c1;
+    }
+
+    // Résultat < 2n: au plus une soustraction
+    if (sup || compareLimbes(t + k, n, k) >= 0) retireLimbes(t + k, n, k);
+    memcpy(r, t + k, sizeof(uint64_t) * k);
+}
+
+// Variantes compilées pour chaque jeu d'instructions à partir du même
+// code: avec BMI2, le compilateur remplace MUL par MULX (sans drapeaux).
+// Multiplication, carré et réduction reposent sur l'addmul de leur variante.
+#define DEFINIR_NOYAUX_DERIVES(suffixe, cible)                                                 \
+    cible static void mulLimbesBasique##suffixe(uint64_t *r, const uint64_t *a, int na,        \
+                                                const uint64_t *b, int nb) {                   \
+        mulBasiqueCorps(r, a, na, b, nb, addmulLimbes##suffixe);                               \
+    }                                                                                          \
+    cible static void carreLimbes##suffixe(uint64_t *r, const uint64_t *a, int n) {            \
+        carreCorps(r, a, n, addmulLimbes##suffixe);                                            \
+    }                                                                                          \
+    cible static void redcLimbes##suffixe(uint64_t *r, uint64_t *t, const uint64_t *n,         \
+                                          uint64_t nInverse, int k) {                          \
+        redcCorps(r, t, n, nInverse, k, addmulLimbes##suffixe);                                \
+    }
+
+#define DEFINIR_NOYAUX_LIMBES(suffixe, cible)                                                  \
+    cible static uint64_t addmulLimbes##suffixe(uint64_t *r, const uint64_t *a, int n,         \
+                                                uint64_t b) {                                  \
+        return addmulCorps(r, a, n, b);                                                        \
+    }                                                                                          \
+    DEFINIR_NOYAUX_DERIVES(suffixe, cible)
+
+DEFINIR_NOYAUX_LIMBES(Generique, )
+#if BIGBINARY_X86
+DEFINIR_NOYAUX_LIMBES(Bmi2, __attribute__((target("bmi2"))))
+
+/**
+ * \brief r[0..n) += a[0..n) * b avec MULX/ADCX/ADOX (Broadwell et suivants)
+ *
+ * Deux chaînes de retenues indépendantes: ADCX (drapeau CF) ajoute les
+ * poids faibles des produits à r, ADOX (drapeau OF) ajoute les poids
+ * forts du produit précédent. MULX ne touche pas aux drapeaux, et les
+ * compteurs avancent avec LEA / JRCXZ pour ne pas les écraser non plus.
+ * Le gros de la boucle traite 4 limbes par tour.
+ */
+static uint64_t addmulLimbesAdx(uint64_t *r, const uint64_t *a, int n, uint64_t b) {
+    uint64_t haut;
+    uint64_t reste = (uint64_t)(-(int64_t)(n & 3));  // tours de 1 limbe (compteur négatif)
+    uint64_t quads = (uint64_t)(-(int64_t)(n >> 2)); // tours de 4 limbes
+
+#define ETAPE_ADX(dep)                                                                         \
+        "mulx " #dep "(%%rsi), %%r8, %%r9\n\t"                                                   \
+        "adcx " #dep "(%%rdi), %%r8\n\t"                                                         \
+        "adox %%rax, %%r8\n\t"                                                                   \
+        "movq %%r8, " #dep "(%%rdi)\n\t"                                                         \
+        "movq %%r9, %%rax\n\t"
+
+    __asm__ volatile(
+        "xorl %%eax, %%eax\n\t"          // rax = 0, CF = OF = 0
+        "jrcxz 2f\n"
+        "1:\n\t"
+        ETAPE_ADX(0)
+        "leaq 8(%%rsi), %%rsi\n\t"
+        "leaq 8(%%rdi), %%rdi\n\t"
+        "leaq 1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n"
+        "2:\n\t"
+        "movq %[quads], %%rcx\n\t"
+        "jrcxz 4f\n"
+        "3:\n\t"
+        ETAPE_ADX(0)
+        ETAPE_ADX(8)
+        ETAPE_ADX(16)
+        ETAPE_ADX(24)
+        "leaq 32(%%rsi), %%rsi\n\t"
+        "leaq 32(%%rdi), %%rdi\n\t"
+        "leaq 1(%%rcx), %%rcx\n\t"
+        "jrcxz 4f\n\t"
+        "jmp 3b\n"
+        "4:\n\t"
+        "movl $0, %%r8d\n\t"             // MOV ne modifie pas les drapeaux
+        "adcx %%r8, %%rax\n\t"
+        "adox %%r8, %%rax\n\t"
+        : "=&a"(haut), "+S"(a), "+D"(r), "+c"(reste)
+        : "d"(b), [quads] "r"(quads)
+        : "r8", "r9", "cc", "memory");
+#undef ETAPE_ADX
+
+    return haut;
+}
+
+DEFINIR_NOYAUX_DERIVES(Adx, __attribute__((target("bmi2,adx"))))
+#endif
+
+// ============================================================================
+// ======== AJOUT: SPÉCIALISATIONS À TAILLE FIXE (1024 À 4096 BITS) ===========
+// ============================================================================
+
+/*
+ * Presque tout le trafic RSA utilise 1024, 2048, 3072 ou 4096 bits. Pour
+ * ces tailles, addition, multiplication, carré, réduction de Montgomery
+ * et exponentiation sont générés par macro avec un nombre de limbes N
+ * constant:
+ * - chaque ligne addmul est déroulée par blocs de 16 limbes (entièrement
+ *   pour 1024 bits), sans compteur de boucle variable
+ * - tous les tampons (table de puissances, produit, accumulateur) sont
+ *   des tableaux sur la pile: aucune allocation pendant le calcul
+ * - R^2 mod n est obtenu par doublements et carrés de Montgomery, sans
+ *   division; le produit modulaire isolé (multiplicationMod) réduit par
+ *   une division de limbes dont les tampons sont eux aussi sur la pile
+ *
+ * Seules les lignes sont déroulées, pas les N lignes du produit: un
+ * produit 4096 bits entièrement déroulé ferait des dizaines de Ko de
+ * code et chasserait le reste du cache d'instructions. Au-delà de 16
+ * limbes, dérouler davantage les lignes est même plus lent (mesuré).
+ */
+
+// Taille de fenêtre de l'exposant (table de 2^4 puissances)
+#define FENETRE_EXPOSANT 4
+
+// Tailles spécialisées, en limbes de 64 bits
+#define NB_TAILLES_FIXES 4
+static const int limbesTaillesFixes[NB_TAILLES_FIXES] = {16, 32, 48, 64};
+
+// Déroulement des boucles à nombre de tours constant
+#if defined(__clang__)
+#define DEROULER _Pragma("unroll 16")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define DEROULER _Pragma("GCC unroll 16")
+#else
+#define DEROULER
+#endif
+
+/**
+ * \brief Chiffre de rang 'fenetre' (FENETRE_EXPOSANT bits) de |e|
+ */
+static int chiffreExposant(BigBinary e, int fenetre) {
+    int chiffre = 0;
+    for (int b = FENETRE_EXPOSANT - 1; b >= 0; --b) {
+        int p = FENETRE_EXPOSANT * fenetre + b;
+        chiffre = (chiffre << 1) | (p < e.Taille ? e.Tdigits[e.Taille - 1 - p] : 0);
+    }
+    return chiffre;
+}
+
+/**
+ * \brief Ligne addmul destinée à être déroulée (n constant après mise en ligne)
+ */
+static TOUJOURS_EN_LIGNE uint64_t addmulDeroule(uint64_t *r, const uint64_t *a, int n, uint64_t b) {
+    uint64_t retenue = 0;
+    DEROULER
+    for (int i = 0; i < n; ++i) {
+        uint64_t haut;
+        uint64_t bas = mul64(a[i], b, &haut);
+        bas += retenue;
+        haut += (bas < retenue);
+        r[i] += bas;
+        haut += (r[i] < bas);
+        retenue = haut;
+    }
+    return retenue;
+}
+
+/**
+ * \brief Addition r += a destinée à être déroulée (n constant après mise en ligne)
+ */
+static TOUJOURS_EN_LIGNE uint64_t ajouteDeroule(uint64_t *r, const uint64_t *a, int n) {
+    uint64_t retenue = 0;
+    DEROULER
+    for (int i = 0; i < n; ++i) {
+        uint64_t s = r[i] + retenue;
+        retenue = (s < retenue);
+        r[i] = s + a[i];
+        retenue += (r[i] < s);
+    }
+    return retenue;
+}
+
+#if BIGBINARY_X86
+/**
+ * \brief Addition r += a avec ADC, destinée à être déroulée
+ */
+static TOUJOURS_EN_LIGNE uint64_t ajouteDerouleAdc(uint64_t *r, const uint64_t *a, int n) {
+    unsigned char retenue = 0;
+    DEROULER
+    for (int i = 0; i < n; ++i) {
+        unsigned long long s;
+        retenue = _addcarry_u64(retenue, r[i], a[i], &s);
+        r[i] = s;
+    }
+    return retenue;
+}
+#endif
+
+/**
+ * \brief x = 2x mod n (x < n), N limbes
+ */
+static TOUJOURS_EN_LIGNE void doubleModCorps(uint64_t *x, const uint64_t *n, int N) {
+    uint64_t sortant = 0;
+    DEROULER
+    for (int i = 0; i < N; ++i) {
+        uint64_t v = x[i];
+        x[i] = (v << 1) | sortant;
+        sortant = v >> 63;
+    }
+    if (sortant || compareLimbes(x, n, N) >= 0) retireLimbes(x, n, N);
+}
+
+/**
+ * \brief M^|e| mod n sur N limbes, tampons fournis par l'appelant (sur sa pile)
+ * \param r Résultat (< n)
+ * \param base M, N limbes (M < 2^(64N))
+ * \param n Module impair de N limbes
+ * \param table 16 * N limbes, acc N limbes, t 2N limbes, r2 N limbes
+ *
+ * Même fenêtre de 4 bits que expModMontgomery.
+ */
+static TOUJOURS_EN_LIGNE void expModFixeCorps(uint64_t *r, const uint64_t *base, const uint64_t *n,
+                                              BigBinary e, int N, uint64_t *table, uint64_t *acc,
+                                              uint64_t *t, uint64_t *r2,
+                                              void (*mul)(uint64_t *, const uint64_t *, const uint64_t *),
+                                              void (*carre)(uint64_t *, const uint64_t *),
+                                              void (*redc)(uint64_t *, uint64_t *, const uint64_t *, uint64_t)) {
+    uint64_t inverse = n[0];
+    for (int i = 0; i < 5; ++i) inverse *= 2 - n[0] * inverse;
+    uint64_t nInverse = 0 - inverse;
+
+    // R mod n (R = 2^(64N)): doublements depuis le bit de tête de n
+    int bits = 64 * N - zerosTete64(n[N - 1]);
+    memset(r2, 0, sizeof(uint64_t) * N);
+    r2[(bits - 1) >> 6] = (uint64_t)1 << ((bits - 1) & 63);
+    for (int i = bits - 1; i < 64 * N; ++i) doubleModCorps(r2, n, N);
+    memcpy(table, r2, sizeof(uint64_t) * N);  // table[0] = R mod n
+
+    // R^2 mod n = 2^(64N) * R: avec 64N = impair * 2^s, "impair" doublements
+    // puis s carrés de Montgomery (chacun double l'exposant de 2)
+    int impair = 64 * N, s = 0;
+    while (!(impair & 1)) {
+        impair >>= 1;
+        ++s;
+    }
+    for (int i = 0; i < impair; ++i) doubleModCorps(r2, n, N);
+    for (int i = 0; i < s; ++i) {
+        carre(t, r2);
+        redc(r2, t, n, nInverse);
+    }
+
+    // table[1] = M * R mod n = REDC(M * R^2)
+    mul(t, base, r2);
+    redc(table + N, t, n, nInverse);
+    for (int j = 2; j < (1 << FENETRE_EXPOSANT); ++j) {
+        mul(t, table + N * (j - 1), table + N);
+        redc(table + N * j, t, n, nInverse);
+    }
+
+    int nbFenetres = (e.Taille + FENETRE_EXPOSANT - 1) / FENETRE_EXPOSANT;
+    memcpy(acc, table + N * chiffreExposant(e, nbFenetres - 1), sizeof(uint64_t) * N);
+    for (int f = nbFenetres - 2; f >= 0; --f) {
+        for (int c = 0; c < FENETRE_EXPOSANT; ++c) {
+            carre(t, acc);
+            redc(acc, t, n, nInverse);
+        }
+        int chiffre = chiffreExposant(e, f);
+        if (chiffre != 0) {
+            mul(t, acc, table + N * chiffre);
+            redc(acc, t, n, nInverse);
+        }
+    }
+
+    memset(t, 0, sizeof(uint64_t) * 2 * N);
+    memcpy(t, acc, sizeof(uint64_t) * N);
+    redc(r, t, n, nInverse);
+}
+
+// Une taille fixe dans une variante: N constant partout, tampons sur la pile
+#define DEFINIR_TAILLE_FIXE(N, suffixe, cible, addmul, ajoute)                                 \
+    cible static uint64_t ajouteFixe##N##suffixe(uint64_t *r, const uint64_t *a) {             \
+        return ajoute(r, a, N);                                                                \
+    }                                                                                          \
+    cible static void mulFixe##N##suffixe(uint64_t *r, const uint64_t *a, const uint64_t *b) { \
+        mulBasiqueCorps(r, a, N, b, N, addmul);                                                \
+    }                                                                                          \
+    cible static void carreFixe##N##suffixe(uint64_t *r, const uint64_t *a) {                  \
+        carreCorps(r, a, N, addmul);                                                           \
+    }                                                                                          \
+    cible static void redcFixe##N##suffixe(uint64_t *r, uint64_t *t, const uint64_t *n,        \
+                                           uint64_t nInverse) {                                \
+        redcCorps(r, t, n, nInverse, N, addmul);                                               \
+    }                                                                                          \
+    cible static void expModFixe##N##suffixe(uint64_t *r, const uint64_t *base,                \
+                                             const uint64_t *n, BigBinary e) {                 \
+        uint64_t table[N << FENETRE_EXPOSANT], acc[N], t[2 * N], r2[N];                        \
+        expModFixeCorps(r, base, n, e, N, table, acc, t, r2, mulFixe##N##suffixe,              \
+                        carreFixe##N##suffixe, redcFixe##N##suffixe);                          \
+    }
+
+// Les 4 tailles d'une variante, et leur table
+#define DEFINIR_TAILLES_FIXES(suffixe, cible, addmul, ajoute)                                  \
+    DEFINIR_TAILLE_FIXE(16, suffixe, cible, addmul, ajoute)                                    \
+    DEFINIR_TAILLE_FIXE(32, suffixe, cible, addmul, ajoute)                                    \
+    DEFINIR_TAILLE_FIXE(48, suffixe, cible, addmul, ajoute)                                    \
+    DEFINIR_TAILLE_FIXE(64, suffixe, cible, addmul, ajoute)                                    \
+    static const NoyauxTailleFixe taillesFixes##suffixe[NB_TAILLES_FIXES] = {                  \
+        {ajouteFixe16##suffixe, mulFixe16##suffixe, expModFixe16##suffixe},                    \
+        {ajouteFixe32##suffixe, mulFixe32##suffixe, expModFixe32##suffixe},                    \
+        {ajouteFixe48##suffixe, mulFixe48##suffixe, expModFixe48##suffixe},                    \
+        {ajouteFixe64##suffixe, mulFixe64##suffixe, expModFixe64##suffixe},                    \
+    };
+
+// Opérations exposées par une taille fixe
+typedef struct {
+    uint64_t (*ajoute)(uint64_t *r, const uint64_t *a);  // r += a, renvoie la retenue
+    void (*mul)(uint64_t *r, const uint64_t *a, const uint64_t *b);
+    void (*expMod)(uint64_t *r, const uint64_t *base, const uint64_t *n, BigBinary e);
+} NoyauxTailleFixe;
+
+DEFINIR_TAILLES_FIXES(Generique, , addmulDeroule, ajouteDeroule)
+#if BIGBINARY_X86
+DEFINIR_TAILLES_FIXES(Bmi2, __attribute__((target("bmi2"))), addmulDeroule, ajouteDerouleAdc)
+DEFINIR_TAILLES_FIXES(Adx, __attribute__((target("bmi2,adx"))), addmulLimbesAdx, ajouteDerouleAdc)
+#endif
+
+/**
+ * \brief Plus petite taille fixe de au moins n limbes
+ * \return Indice dans limbesTaillesFixes, ou -1 si n dépasse 4096 bits
+ */
+static int indiceTailleFixe(int n) {
+    for (int i = 0; i < NB_TAILLES_FIXES; ++i) {
+        if (n <= limbesTaillesFixes[i]) return i;
+    }
+    return -1;
+}
+
+// ============================================================================
+// ============ AJOUT: CHOIX DES NOYAUX DE CALCUL SELON LE PROCESSEUR =========
+// ============================================================================
+
+/*
+ * Un même exécutable doit tourner sur toutes les générations de x86-64.
+ * Les extensions du processeur sont détectées au chargement de la
+ * bibliothèque et chaque opération est liée à sa meilleure variante:
+ *
+ *   addmul, multiplication, carré,
+ *   réduction de Montgomery,
+ *   tailles fixes 1024-4096 bits  : générique | BMI2 (MULX, ADC) | ADX (MULX + ADCX/ADOX)
+ *   addition                      : générique | ADC (x86-64)
+ *   Montgomery par lots           : générique | AVX2 | AVX-512
+ *
+ * choisirExtensions() (ou la variable d'environnement BIGBINARY_EXTENSIONS,
+ * lue au chargement) restreint les extensions utilisables, pour les tests
+ * et les mesures. Hors x86-64, seules les variantes génériques existent.
+ */
+
+typedef void (*NoyauMontgomeryLot)(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                   const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t);
+
+// Noyaux liés aux opérations (une entrée par opération)
+typedef struct {
+    uint64_t (*addmul)(uint64_t *r, const uint64_t *a, int n, uint64_t b);
+    uint64_t (*ajoute)(uint64_t *r, const uint64_t *a, int n);
+    void (*mulBasique)(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb);
+    void (*carre)(uint64_t *r, const uint64_t *a, int n);
+    void (*redc)(uint64_t *r, uint64_t *t, const uint64_t *n, uint64_t nInverse, int k);
+    NoyauMontgomeryLot montgomeryLot;
+    const NoyauxTailleFixe *fixes;  // 1024, 2048, 3072 et 4096 bits
+    unsigned int extensions;      // Extensions réellement utilisées
+    const char *nomScalaire;      // Variante de addmul, multiplication, carré et réduction
+    const char *nomAjoute;
+    const char *nomMontgomery;
+} NoyauxArithmetiques;
+
+// Noyaux de Montgomery par lots (définis avec l'exponentiation par lots)
+static void montgomeryLot4Portable(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                   const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t);
+#if BIGBINARY_X86
+__attribute__((target("avx2")))
+static void montgomeryLot4Avx2(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                               const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t);
+__attribute__((target("avx512f")))
+static void montgomeryLot4Avx512(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                 const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t);
+#endif
+
+// Variantes génériques: valables partout, avant même la détection
+static NoyauxArithmetiques noyaux = {
+    addmulLimbesGenerique, ajouteLimbes, mulLimbesBasiqueGenerique, carreLimbesGenerique,
+    redcLimbesGenerique, montgomeryLot4Portable, taillesFixesGenerique, 0,
+    "generique", "generique", "generique"
+};
+
+/**
+ * \brief Extensions présentes sur le processeur courant (BIGBINARY_EXT_*)
+ */
+unsigned int extensionsDetectees(void) {
+    unsigned int extensions = 0;
+#if BIGBINARY_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("bmi2")) extensions |= BIGBINARY_EXT_BMI2;
+    if (__builtin_cpu_supports("avx2")) extensions |= BIGBINARY_EXT_AVX2;
+    if (__builtin_cpu_supports("avx512f")) extensions |= BIGBINARY_EXT_AVX512;
+
+    // ADX n'est pas connu de tous les compilateurs: CPUID feuille 7, EBX bit 19
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 19))) {
+        extensions |= BIGBINARY_EXT_ADX;
+    }
+#endif
+    return extensions;
+}
+
+/**
+ * \brief Restreint les extensions utilisées par les noyaux de calcul
+ * \param autorisees Masque BIGBINARY_EXT_* (0 = variantes génériques seules,
+ *                   BIGBINARY_EXT_TOUTES = meilleure variante disponible)
+ * \return Extensions réellement utilisées (détectées, autorisées et exploitées)
+ *
+ * À appeler avant de lancer des calculs dans d'autres threads: la table
+ * des noyaux n'est pas protégée contre les modifications concurrentes.
+ */
+unsigned int choisirExtensions(unsigned int autorisees) {
+    NoyauxArithmetiques choix = {
+        addmulLimbesGenerique, ajouteLimbes, mulLimbesBasiqueGenerique, carreLimbesGenerique,
+        redcLimbesGenerique, montgomeryLot4Portable, taillesFixesGenerique, 0,
+        "generique", "generique", "generique"
+    };
+
+#if BIGBINARY_X86
+    unsigned int disponibles = extensionsDetectees() & autorisees;
+
+    choix.ajoute = ajouteLimbesAdc;
+    choix.nomAjoute = "adc";
+
+    if ((disponibles & BIGBINARY_EXT_BMI2) && (disponibles & BIGBINARY_EXT_ADX)) {
+        choix.addmul = addmulLimbesAdx;
+        choix.mulBasique = mulLimbesBasiqueAdx;
+        choix.carre = carreLimbesAdx;
+        choix.redc = redcLimbesAdx;
+        choix.fixes = taillesFixesAdx;
+        choix.nomScalaire = "adx";
+        choix.extensions |= BIGBINARY_EXT_BMI2 | BIGBINARY_EXT_ADX;
+    } else if (disponibles & BIGBINARY_EXT_BMI2) {
+        choix.addmul = addmulLimbesBmi2;
+        choix.mulBasique = mulLimbesBasiqueBmi2;
+        choix.carre = carreLimbesBmi2;
+        choix.redc = redcLimbesBmi2;
+        choix.fixes = taillesFixesBmi2;
+        choix.nomScalaire = "bmi2";
+        choix.extensions |= BIGBINARY_EXT_BMI2;
+    }
+
+    if (disponibles & BIGBINARY_EXT_AVX512) {
+        choix.montgomeryLot = montgomeryLot4Avx512;
+        choix.nomMontgomery = "avx512";
+        choix.extensions |= BIGBINARY_EXT_AVX512;
+    } else if (disponibles & BIGBINARY_EXT_AVX2) {
+        choix.montgomeryLot = montgomeryLot4Avx2;
+        choix.nomMontgomery = "avx2";
+        choix.extensions |= BIGBINARY_EXT_AVX2;
+    }
+#else
+    (void)autorisees;
+#endif
+
+    noyaux = choix;
+    return noyaux.extensions;
+}
+
+/**
+ * \brief Extensions utilisées par les noyaux actuellement liés
+ */
+unsigned int extensionsActives(void) {
+    return noyaux.extensions;
+}
+
+/**
+ * \brief Lit une liste d'extensions ("bmi2,avx2", "toutes", "aucune"...)
+ */
+static unsigned int lireExtensions(const char *texte) {
+    if (strstr(texte, "toutes") != NULL) return BIGBINARY_EXT_TOUTES;
+
+    unsigned int masque = 0;
+    if (strstr(texte, "bmi2") != NULL) masque |= BIGBINARY_EXT_BMI2;
+    if (strstr(texte, "adx") != NULL) masque |= BIGBINARY_EXT_ADX;
+    if (strstr(texte, "avx2") != NULL) masque |= BIGBINARY_EXT_AVX2;
+    if (strstr(texte, "avx512") != NULL) masque |= BIGBINARY_EXT_AVX512;
+    return masque;
+}
+
+/**
+ * \brief Lie les noyaux au chargement de la bibliothèque
+ *
+ * BIGBINARY_EXTENSIONS=aucune (ou "bmi2,avx2"...) force une variante sans
+ * recompiler, pour comparer les noyaux sur une même machine.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void initialiserNoyaux(void) {
+    const char *texte = getenv("BIGBINARY_EXTENSIONS");
+    choisirExtensions(texte != NULL ? lireExtensions(texte) : BIGBINARY_EXT_TOUTES);
+}
+
+/**
+ * \brief Affiche les extensions détectées et les variantes utilisées
+ */
+void afficheNoyaux(void) {
+    unsigned int detectees = extensionsDetectees();
+    printf("Extensions détectées:%s%s%s%s%s\n",
+           detectees == 0 ? " aucune" : "",
+           (detectees & BIGBINARY_EXT_BMI2) ? " bmi2" : "",
+           (detectees & BIGBINARY_EXT_ADX) ? " adx" : "",
+           (detectees & BIGBINARY_EXT_AVX2) ? " avx2" : "",
+           (detectees & BIGBINARY_EXT_AVX512) ? " avx512f" : "");
+    printf("Noyaux: addmul/multiplication/carré/réduction = %s, addition = %s, Montgomery par lots = %s\n",
+           noyaux.nomScalaire, noyaux.nomAjoute, noyaux.nomMontgomery);
+}
+
+// ============================================================================
+// ============= AJOUT: ARITHMÉTIQUE INTERNE SUR LES LIMBES (SUITE) ===========
+// ============================================================================
+
+static void mulLimbes(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb);
+
+// Un produit r = a * b, exécutable comme sous-tâche
+typedef struct {
+    uint64_t *r;
+    const uint64_t *a;
+    const uint64_t *b;
+    int na;
+    int nb;
+} SousProduit;
+
+static void tacheSousProduit(int indice, void *contexteTache) {
+    SousProduit *p = (SousProduit *)contexteTache + indice;
+    mulLimbes(p->r, p->a, p->na, p->b, p->nb);
+}
+
+/**
+ * \brief Multiplication de Karatsuba pour deux opérandes de n limbes
+ *
+ * a = a1 * X + a0, b = b1 * X + b0 avec X = 2^(64h):
+ * a * b = z2 * X^2 + (z1 - z2 - z0) * X + z0
+ * avec z0 = a0 * b0, z2 = a1 * b1, z1 = (a0 + a1) * (b0 + b1).
+ * Trois produits de taille n/2 au lieu de quatre.
+ *
+ * Les trois produits écrivent dans des zones disjointes: au-delà de
+ * SEUIL_KARATSUBA_PARALLELE limbes, ils sont confiés à l'exécuteur du
+ * thread (et le découpage se poursuit récursivement dans chacun).
+ */
+static void mulKaratsuba(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    int h = n / 2;      // Taille de la moitié basse
+    int m = n - h;      // Taille de la moitié haute (m >= h)
+
+    // Sommes des moitiés (m + 1 limbes chacune)
+    uint64_t *sa = alloueLimbesZero(m + 1);
+    uint64_t *sb = alloueLimbesZero(m + 1);
+    memcpy(sa, a + h, sizeof(uint64_t) * m);
+    memcpy(sb, b + h, sizeof(uint64_t) * m);
+    propageRetenue(sa + h, m + 1 - h, noyaux.ajoute(sa, a, h));
+    propageRetenue(sb + h, m + 1 - h, noyaux.ajoute(sb, b, h));
+
+    // z0 dans r[0..2h), z2 dans r[2h..2n), z1 = sa * sb à part
+    int n1 = 2 * (m + 1);
+    uint64_t *z1 = alloueLimbes(n1);
+    SousProduit produits[3] = {
+        {r, a, b, h, h},
+        {r + 2 * h, a + h, b + h, m, m},
+        {z1, sa, sb, m + 1, m + 1},
+    };
+    const ExecuteurBigBinary *executeur = executeurCourant();
+    if (executeur != NULL && n >= SEUIL_KARATSUBA_PARALLELE) {
+        executeur->executer(3, tacheSousProduit, produits, executeur->contexte);
+    } else {
+        for (int i = 0; i < 3; ++i) tacheSousProduit(i, produits);
+    }
+
+    // z1 -= z0 + z2
+    propageEmprunt(z1 + 2 * h, n1 - 2 * h, retireLimbes(z1, r, 2 * h));
+    propageEmprunt(z1 + 2 * m, n1 - 2 * m, retireLimbes(z1, r + 2 * h, 2 * m));
+
+    // r += z1 * X (z1 tient sur 2m + 1 limbes au plus)
+    int utile = n1;
+    while (utile > 0 && z1[utile - 1] == 0) utile--;
+    if (utile > 2 * n - h) utile = 2 * n - h;
+    propageRetenue(r + h + utile, 2 * n - h - utile, noyaux.ajoute(r + h, z1, utile));
+
+    libereLimbes(sa, m + 1);
+    libereLimbes(sb, m + 1);
+    libereLimbes(z1, n1);
+}
+
+/**
+ * \brief Multiplication de limbes: r[0..na+nb) = a * b
+ *
+ * Choisit l'algorithme selon la taille: scolaire pour les petits
+ * opérandes, Karatsuba pour les grands. Un opérande beaucoup plus long
+ * que l'autre est découpé en tranches de la taille du plus court.
+ */
+static void mulLimbes(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb) {
+    // On s'arrange pour que a soit le plus long
+    if (na < nb) {
+        const uint64_t *t = a; a = b; b = t;
+        int tn = na; na = nb; nb = tn;
+    }
+
+    if (nb < SEUIL_KARATSUBA) {
+        if (a == b && na == nb) {
+            noyaux.carre(r, a, na);
+        } else {
+            noyaux.mulBasique(r, a, na, b, nb);
+        }
+        return;
+    }
+
+    if (na == nb) {
+        mulKaratsuba(r, a, b, na);
+        return;
+    }
+
+    // === OPÉRANDES DÉSÉQUILIBRÉS: tranches de nb limbes de a ===
+    memset(r, 0, sizeof(uint64_t) * (na + nb));
+    uint64_t *tmp = alloueLimbes(2 * nb);
+    for (int debut = 0; debut < na; debut += nb) {
+        int longueur = (na - debut < nb) ? na - debut : nb;
+        mulLimbes(tmp, a + debut, longueur, b, nb);
+        int total = na + nb - debut;
+        propageRetenue(r + debut + longueur + nb, total - longueur - nb,
+                       noyaux.ajoute(r + debut, tmp, longueur + nb));
+    }
+    libereLimbes(tmp, 2 * nb);
+}
+
+/**
+ * \brief Division de limbes (Knuth, algorithme D): u = q * v + r, tampons fournis
+ * \param q Quotient, nu - nv + 1 limbes (peut être NULL)
+ * \param r Reste, nv limbes (peut être NULL)
+ * \param u Dividende, nu limbes
+ * \param v Diviseur, nv limbes avec v[nv - 1] != 0
+ * \param vn Tampon de nv limbes (diviseur normalisé)
+ * \param un Tampon de nu + 1 limbes (dividende normalisé)
+ *
+ * Le diviseur est normalisé (bit de poids fort à 1) pour que chaque
+ * chiffre estimé du quotient soit faux d'au plus 2. Les tailles fixes
+ * passent des tampons sur leur pile: aucune allocation.
+ */
+static void divLimbesTampons(uint64_t *q, uint64_t *r, const uint64_t *u, int nu,
+                             const uint64_t *v, int nv, uint64_t *vn, uint64_t *un) {
+    if (nu < nv) {
+        if (q) q[0] = 0;
+        if (r) {
+            memset(r, 0, sizeof(uint64_t) * nv);
+            memcpy(r, u, sizeof(uint64_t) * nu);
+        }
+        return;
+    }
+
+    // === DIVISEUR D'UN SEUL LIMBE: inverse précalculé ===
+    if (nv == 1) {
+        uint64_t reste = 0;
+        for (int i = nu - 1; i >= 0; --i) {
+            uint64_t chiffre = div128(reste, u[i], v[0], &reste);
+            if (q) q[i] = chiffre;
+        }
+        if (r) r[0] = reste;
+        return;
+    }
+
+    // === NORMALISATION ===
+    int s = 0;
+    for (uint64_t t = v[nv - 1]; !(t & 0x8000000000000000ULL); t <<= 1) s++;
+
+    for (int i = nv - 1; i > 0; --i) {
+        vn[i] = (v[i] << s) | (s ? v[i - 1] >> (64 - s) : 0);
+    }
+    vn[0] = v[0] << s;
+    un[nu] = s ? u[nu - 1] >> (64 - s) : 0;
+    for (int i = nu - 1; i > 0; --i) {
+        un[i] = (u[i] << s) | (s ? u[i - 1] >> (64 - s) : 0);
+    }
+    un[0] = u[0] << s;
+
+    uint64_t vHaut = vn[nv - 1];
+    uint64_t vSuivant = vn[nv - 2];
+
+    // === BOUCLE PRINCIPALE: un chiffre du quotient par tour ===
+    for (int j = nu - nv; j >= 0; --j) {
+        // Estimation du chiffre à partir des deux limbes de tête
+        uint64_t qChapeau, rChapeau;
+        int rDeborde = 0;
+        if (un[j + nv] >= vHaut) {
+            qChapeau = ~(uint64_t)0;
+            rChapeau = un[j + nv - 1] + vHaut;
+            rDeborde = (rChapeau < vHaut);
+        } else {
+            qChapeau = div128(un[j + nv], un[j + nv - 1], vHaut, &rChapeau);
+        }
+
+        // Correction (au plus deux fois) avec le limbe suivant
+        while (!rDeborde) {
+            uint64_t pHaut;
+            uint64_t pBas = mul64(qChapeau, vSuivant, &pHaut);
+            if (pHaut < rChapeau || (pHaut == rChapeau && pBas <= un[j + nv - 2])) break;
+            qChapeau--;
+            rChapeau += vHaut;
+            rDeborde = (rChapeau < vHaut);
+        }
+
+        // Multiplier et soustraire: un[j..j+nv] -= qChapeau * vn
+        uint64_t emprunt = 0, retenue = 0;
+        for (int i = 0; i < nv; ++i) {
+            uint64_t pHaut;
+            uint64_t pBas = mul64(qChapeau, vn[i], &pHaut);
+            pBas += retenue;
+            pHaut += (pBas < retenue);
+            retenue = pHaut;
+
+            uint64_t x = un[i + j];
+            uint64_t d = x - pBas;
+            uint64_t e = (d > x);
+            un[i + j] = d - emprunt;
+            e += (un[i + j] > d);
+            emprunt = e;
+        }
+        uint64_t x = un[j + nv];
+        un[j + nv] = x - retenue - emprunt;
+        int negatif = (x < retenue) || (x - retenue < emprunt);
+
+        // Estimation trop grande d'une unité: rajouter le diviseur
+        if (negatif) {
+            qChapeau--;
+            un[j + nv] += noyaux.ajoute(un + j, vn, nv);
+        }
+        if (q) q[j] = qChapeau;
+    }
+
+    // === DÉNORMALISER LE RESTE ===
+    if (r) {
+        for (int i = 0; i < nv - 1; ++i) {
+            r[i] = (un[i] >> s) | (s ? un[i + 1] << (64 - s) : 0);
+        }
+        r[nv - 1] = un[nv - 1] >> s;
+    }
+}
+
+/**
+ * \brief Division de limbes: u = q * v + r (voir divLimbesTampons), tampons sur le tas
+ */
+static void divLimbes(uint64_t *q, uint64_t *r, const uint64_t *u, int nu,
+                      const uint64_t *v, int nv) {
+    if (nu < nv || nv == 1) {
+        divLimbesTampons(q, r, u, nu, v, nv, NULL, NULL);  // Cas sans tampon (pas de normalisation)
+        return;
+    }
+    uint64_t *vn = alloueLimbes(nv);
+    uint64_t *un = alloueLimbes(nu + 1);
+    divLimbesTampons(q, r, u, nu, v, nv, vn, un);
+    libereLimbes(vn, nv);
+    libereLimbes(un, nu + 1);
+}
+
+// Taille (en limbes) en dessous de laquelle l'inverse est calculé par
+// division scolaire plutôt que par itération de Newton
+#define SEUIL_INVERSE_NEWTON 32
+
+/**
+ * \brief Inverse d'un diviseur normalisé: v[0..k] = floor(B^(2k) / d), B = 2^64
+ * \param v Résultat, k + 1 limbes
+ * \param d Diviseur de k limbes, bit de poids fort à 1
+ *
+ * Itération de Newton à précision doublée: l'inverse x0 de la moitié
+ * haute de d (calculé récursivement) est corrigé par
+ * x1 = x0 - x0 * (d * x0 - B^(2k)) / B^(2k), qui double le nombre de
+ * limbes exacts. L'erreur restante (quelques unités) est ensuite
+ * rattrapée en comparant d * x1 à B^(2k). Coût: quelques produits de
+ * taille k (Karatsuba) au lieu d'une division scolaire en O(k^2).
+ */
+static void inverseLimbes(uint64_t *v, const uint64_t *d, int k) {
+    int n2 = 2 * k + 1;
+    uint64_t *p = alloueLimbes(n2);
+
+    if (k <= SEUIL_INVERSE_NEWTON) {
+        memset(p, 0, sizeof(uint64_t) * n2);
+        p[2 * k] = 1;
+        uint64_t *q = alloueLimbes(k + 2);
+        divLimbes(q, NULL, p, n2, d, k);
+        memcpy(v, q, sizeof(uint64_t) * (k + 1));  // q[k + 1] = 0 car v <= 2 * B^k
+        libereLimbes(q, k + 2);
+        libereLimbes(p, n2);
+        return;
+    }
+
+    // === APPROXIMATION: x0 = floor(B^(2h) / d_haut) * B^l ===
+    int h = (k + 1) / 2, l = k - h;
+    uint64_t *vh = alloueLimbes(h + 1);
+    inverseLimbes(vh, d + l, h);
+    memset(v, 0, sizeof(uint64_t) * l);
+    memcpy(v + l, vh, sizeof(uint64_t) * (h + 1));
+
+    // === NEWTON: e = |d * x0 - B^(2k)|, x1 = x0 -/+ floor(vh * e / B^(k+h)) ===
+    mulLimbes(p, d, k, v, k + 1);  // d * x0 < 2 * B^(2k): p[2k] vaut 0 ou 1
+    bool exces = (p[2 * k] != 0);
+    if (exces) {
+        p[2 * k] = 0;
+    } else {
+        // B^(2k) - p sur 2k limbes (complément à deux, p > 0)
+        for (int i = 0; i < 2 * k; ++i) p[i] = ~p[i];
+        propageRetenue(p, 2 * k, 1);
+    }
+    int ne = 2 * k;
+    while (ne > 1 && p[ne - 1] == 0) ne--;
+    int nc = h + 1 + ne;
+    uint64_t *c = alloueLimbes(nc);
+    mulLimbes(c, vh, h + 1, p, ne);
+    if (nc > k + h) {
+        int utile = nc - (k + h);
+        if (utile > k + 1) utile = k + 1;
+        if (exces) {
+            propageEmprunt(v + utile, k + 1 - utile, retireLimbes(v, c + k + h, utile));
+        } else {
+            propageRetenue(v + utile, k + 1 - utile, noyaux.ajoute(v, c + k + h, utile));
+        }
+    }
+    libereLimbes(c, nc);
+    libereLimbes(vh, h + 1);
+
+    // === CORRECTION EXACTE: d * v <= B^(2k) < d * (v + 1) ===
+    mulLimbes(p, d, k, v, k + 1);
+    for (;;) {
+        // p > B^(2k) ?
+        bool trop = p[2 * k] > 1;
+        for (int i = 0; !trop && p[2 * k] == 1 && i < 2 * k; ++i) trop = (p[i] != 0);
+        if (!trop) break;
+        propageEmprunt(p + k, k + 1, retireLimbes(p, d, k));
+        propageEmprunt(v, k + 1, 1);
+    }
+    for (;;) {
+        propageRetenue(p + k, k + 1, noyaux.ajoute(p, d, k));
+        bool trop = p[2 * k] > 1;
+        for (int i = 0; !trop && p[2 * k] == 1 && i < 2 * k; ++i) trop = (p[i] != 0);
+        if (trop) break;
+        propageRetenue(v, k + 1, 1);
+    }
+    libereLimbes(p, n2);
+}
+
+/**
+ * \brief Une étape de Barrett: y = q * d + r pour y < B^(2k) (ny limbes, k <= ny <= 2k)
+ * \param q Quotient, ny - k + 1 limbes
+ * \param y Dividende, remplacé par le reste dans y[0..k)
+ *
+ * q = floor(floor(y / B^(k-1)) * v / B^(k+1)) est faux d'au plus 2
+ * (Menezes et al., Handbook of Applied Cryptography, 14.42).
+ */
+static void etapeBarrett(uint64_t *q, uint64_t *y, int ny, const uint64_t *d,
+                         const uint64_t *v, int k) {
+    int nq = ny - k + 1;
+    uint64_t *t = alloueLimbes(nq + k + 1);
+    mulLimbes(t, y + k - 1, nq, v, k + 1);
+    memcpy(q, t + k + 1, sizeof(uint64_t) * nq);
+    libereLimbes(t, nq + k + 1);
+
+    uint64_t *produit = alloueLimbes(nq + k);  // q * d <= y: le limbe de tête est nul
+    mulLimbes(produit, q, nq, d, k);
+    retireLimbes(y, produit, ny);
+    libereLimbes(produit, nq + k);
+
+    for (;;) {
+        bool plusGrand = false;
+        for (int i = k; i < ny && !plusGrand; ++i) plusGrand = (y[i] != 0);
+        if (!plusGrand && compareLimbes(y, d, k) < 0) break;
+        propageEmprunt(y + k, ny - k, retireLimbes(y, d, k));
+        propageRetenue(q, nq, 1);
+    }
+}
+
+/**
+ * \brief Division par un diviseur d'inverse connu (Barrett): u = q * d + r
+ * \param q Quotient, nu - k + 1 limbes
+ * \param r Reste, k limbes
+ * \param u Dividende, nu limbes
+ * \param d Diviseur normalisé de k limbes
+ * \param v Inverse de d (inverseLimbes), k + 1 limbes
+ *
+ * Le dividende est traité par fenêtres de 2k limbes au plus, du poids
+ * fort vers le poids faible (division scolaire en base B^k): chaque
+ * fenêtre coûte deux produits de taille k.
+ */
+static void divLimbesBarrett(uint64_t *q, uint64_t *r, const uint64_t *u, int nu,
+                             const uint64_t *d, const uint64_t *v, int k) {
+    if (nu < k) {
+        q[0] = 0;
+        memset(r, 0, sizeof(uint64_t) * k);
+        memcpy(r, u, sizeof(uint64_t) * nu);
+        return;
+    }
+
+    // Fenêtre y = reste * B^c + c limbes suivants de u (y < d * B^c <= B^(2k))
+    uint64_t *y = alloueLimbes(2 * k);
+    int pos = nu - (nu < 2 * k ? nu : 2 * k);
+    memcpy(y, u + pos, sizeof(uint64_t) * (nu - pos));
+    etapeBarrett(q + pos, y, nu - pos, d, v, k);
+
+    uint64_t *chiffres = alloueLimbes(k + 1);
+    while (pos > 0) {
+        int c = pos < k ? pos : k;
+        pos -= c;
+        memmove(y + c, y, sizeof(uint64_t) * k);
+        memcpy(y, u + pos, sizeof(uint64_t) * c);
+        etapeBarrett(chiffres, y, k + c, d, v, k);
+        memcpy(q + pos, chiffres, sizeof(uint64_t) * c);  // chiffres[c] = 0 car y < d * B^c
+    }
+    memcpy(r, y, sizeof(uint64_t) * k);
+
+    libereLimbes(chiffres, k + 1);
+    libereLimbes(y, 2 * k);
+}
+
+// ============================================================================
+// ======= AJOUT: MULTIPLICATION ET EXPONENTIATION SUR LES LIMBES (RSA) =======
+// ============================================================================
+
+/*
+ * Aux tailles RSA (1024 à 4096 bits), MultiplicationEgyptienne,
+ * multiplicationMod et ExpMod passent par les limbes de 64 bits: les
+ * boucles internes deviennent les noyaux addmul / réduction de Montgomery
+ * choisis selon le processeur (MULX/ADCX/ADOX si disponibles).
+ */
+
+/**
+ * \brief |A| * |B| sur la pile si les deux opérandes tiennent dans une même taille fixe
+ * \param produit Reçoit le produit (positif) en cas de succès
+ * \return true si la taille fixe a été utilisée
+ *
+ * Les deux opérandes doivent occuper plus de la moitié de la taille:
+ * sinon les limbes nuls de bourrage coûteraient plus que le déroulement
+ * ne rapporte, et mulLimbes reste préférable.
+ */
+static bool produitTailleFixe(BigBinary A, BigBinary B, BigBinary *produit) {
+    int na = (A.Taille + 63) / 64, nb = (B.Taille + 63) / 64;
+    int i = indiceTailleFixe(na > nb ? na : nb);
+    if (i < 0) return false;
+    int N = limbesTaillesFixes[i];
+    if (2 * na <= N || 2 * nb <= N) return false;
+
+    uint64_t a[64], b[64], p[128];
+    chargeLimbes(A, a, N);
+    chargeLimbes(B, b, N);
+    noyaux.fixes[i].mul(p, a, b);
+    *produit = depuisLimbes(p, 2 * N, 1);
+    return true;
+}
+
+/**
+ * \brief |A| + |B| sur la pile si les deux opérandes tiennent dans une même taille fixe
+ * \param somme Reçoit la somme (positive) en cas de succès
+ * \return true si la taille fixe a été utilisée
+ *
+ * Même condition de remplissage que produitTailleFixe.
+ */
+static bool additionTailleFixe(BigBinary A, BigBinary B, BigBinary *somme) {
+    int na = (A.Taille + 63) / 64, nb = (B.Taille + 63) / 64;
+    int i = indiceTailleFixe(na > nb ? na : nb);
+    if (i < 0) return false;
+    int N = limbesTaillesFixes[i];
+    if (2 * na <= N || 2 * nb <= N) return false;
+
+    uint64_t a[65], b[64];
+    chargeLimbes(A, a, N);
+    chargeLimbes(B, b, N);
+    a[N] = noyaux.fixes[i].ajoute(a, b);
+    *somme = depuisLimbes(a, N + 1, 1);
+    return true;
+}
+
+/**
+ * \brief Produit A * B calculé sur les limbes (règle des signes appliquée)
+ */
+static BigBinary produitLimbes(BigBinary A, BigBinary B) {
+    BigBinary resultat;
+    if (produitTailleFixe(A, B, &resultat)) {
+        resultat.Signe = A.Signe * B.Signe;
+        return resultat;
+    }
+
+    int na, nb;
+    uint64_t *a = versLimbes(A, &na);
+    uint64_t *b = versLimbes(B, &nb);
+    uint64_t *p = alloueLimbes(na + nb);
+
+    mulLimbes(p, a, na, b, nb);
+    resultat = depuisLimbes(p, na + nb, A.Signe * B.Signe);
+
+    libereLimbes(p, na + nb);
+    libereLimbes(b, nb);
+    libereLimbes(a, na);
+    return resultat;
+}
+
+/**
+ * \brief Division de |A| par |B| sur les limbes, pour |A| > |B| > 0
+ * \param quotient Reçoit |A| / |B| (NULL si seul le reste sert)
+ * \return |A| mod |B|
+ */
+static BigBinary divisionLimbes(BigBinary A, BigBinary B, BigBinary *quotient) {
+    int nu, nv;
+    uint64_t *u = versLimbes(A, &nu);
+    uint64_t *v = versLimbes(B, &nv);
+    uint64_t *q = (quotient != NULL) ? alloueLimbes(nu - nv + 1) : NULL;
+    uint64_t *r = alloueLimbes(nv);
+
+    divLimbes(q, r, u, nu, v, nv);
+    BigBinary reste = depuisLimbes(r, nv, 1);
+    if (quotient != NULL) {
+        *quotient = depuisLimbes(q, nu - nv + 1, 1);
+        libereLimbes(q, nu - nv + 1);
+    }
+
+    libereLimbes(r, nv);
+    libereLimbes(v, nv);
+    libereLimbes(u, nu);
+    return reste;
+}
+
+/**
+ * \brief Nombre de zéros de poids faible de a[0..n) (non nul)
+ */
+static int zerosFinauxLimbes(const uint64_t *a, int n) {
+    int i = 0;
+    while (i < n - 1 && a[i] == 0) i++;
+    int zeros = 64 * i;
+    for (uint64_t x = a[i]; !(x & 1); x >>= 1) zeros++;
+    return zeros;
+}
+
+/**
+ * \brief a[0..n) >>= s, puis renvoie la longueur utile (sans limbes nuls de tête)
+ */
+static int decaleDroiteLimbes(uint64_t *a, int n, int s) {
+    int mots = s / 64, bits = s % 64;
+    for (int i = 0; i < n; ++i) {
+        uint64_t bas = (i + mots < n) ? a[i + mots] : 0;
+        uint64_t haut = (i + mots + 1 < n) ? a[i + mots + 1] : 0;
+        a[i] = bits ? (bas >> bits) | (haut << (64 - bits)) : bas;
+    }
+    while (n > 0 && a[n - 1] == 0) n--;
+    return n;
+}
+
+/**
+ * \brief PGCD de |A| et |B| (non nuls) sur les limbes
+ *
+ * Même algorithme binaire que PGCD_consomme: les facteurs 2 communs sont
+ * mis de côté, puis le plus grand des deux impairs est remplacé par
+ * (a - b) / 2^z jusqu'à égalité. Chaque tour retire au moins un bit et
+ * coûte une soustraction de limbes au lieu d'une soustraction bit à bit.
+ */
+static BigBinary pgcdLimbes(BigBinary A, BigBinary B) {
+    int na, nb;
+    uint64_t *a = versLimbes(A, &na);
+    uint64_t *b = versLimbes(B, &nb);
+    int tailleA = na, tailleB = nb;
+
+    int zerosA = zerosFinauxLimbes(a, na), zerosB = zerosFinauxLimbes(b, nb);
+    int facteur2 = zerosA < zerosB ? zerosA : zerosB;
+    na = decaleDroiteLimbes(a, na, zerosA);
+    nb = decaleDroiteLimbes(b, nb, zerosB);
+
+    // a et b impairs: PGCD(a, b) = PGCD((a - b) / 2^z, b) pour a > b
+    int cmp;
+    while ((cmp = (na != nb) ? (na < nb ? -1 : 1) : compareLimbes(a, b, na)) != 0) {
+        if (cmp < 0) {
+            uint64_t *t = a;
+            a = b;
+            b = t;
+            int n = na;
+            na = nb;
+            nb = n;
+            n = tailleA;
+            tailleA = tailleB;
+            tailleB = n;
+        }
+        propageEmprunt(a + nb, na - nb, retireLimbes(a, b, nb));
+        na = decaleDroiteLimbes(a, na, zerosFinauxLimbes(a, na));
+    }
+
+    BigBinary resultat = depuisLimbes(a, na, 1);
+    decaleGaucheEnPlace(&resultat, facteur2);
+    libereLimbes(b, tailleB);
+    libereLimbes(a, tailleA);
+    return resultat;
+}
+
+/**
+ * \brief (A * B) mod n sur les limbes, pour A, B >= 0 et n > 0
+ */
+static BigBinary produitModLimbes(BigBinary A, BigBinary B, BigBinary n) {
+    int nn = (n.Taille + 63) / 64, i = indiceTailleFixe(nn);
+    if (i >= 0 && A.Taille <= 64 * limbesTaillesFixes[i] && B.Taille <= 64 * limbesTaillesFixes[i]) {
+        // Opérandes de la taille du module: produit sur la pile, une seule division
+        int N = limbesTaillesFixes[i];
+        // Réduction sur la pile elle aussi (tampons de la division fournis)
+        uint64_t a[64], b[64], p[128], m[64], r[64], mNormalise[64], pNormalise[129];
+        chargeLimbes(A, a, N);
+        chargeLimbes(B, b, N);
+        chargeLimbes(n, m, nn);
+        noyaux.fixes[i].mul(p, a, b);
+        divLimbesTampons(NULL, r, p, 2 * N, m, nn, mNormalise, pNormalise);
+        return depuisLimbes(r, nn, 1);
+    }
+
+    int na, nb;
+    uint64_t *a = versLimbes(A, &na);
+    uint64_t *b = versLimbes(B, &nb);
+    uint64_t *m = versLimbes(n, &nn);
+    uint64_t *p = alloueLimbes(na + nb);
+    uint64_t *r = alloueLimbes(nn);
+
+    mulLimbes(p, a, na, b, nb);
+    divLimbes(NULL, r, p, na + nb, m, nn);
+    BigBinary resultat = depuisLimbes(r, nn, 1);
+
+    libereLimbes(r, nn);
+    libereLimbes(p, na + nb);
+    libereLimbes(m, nn);
+    libereLimbes(b, nb);
+    libereLimbes(a, na);
+    return resultat;
+}
+
+/**
+ * \brief Produit de Montgomery r = a * b * 2^(-64k) mod n (a, b < n)
+ * \param t Tampon de 2k limbes
+ */
+static void produitMontgomery(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *n,
+                              uint64_t nInverse, int k, uint64_t *t) {
+    mulLimbes(t, a, k, b, k);  // carré spécialisé si a == b
+    noyaux.redc(r, t, n, nInverse, k);
+}
+
+/**
+ * \brief M^|e| mod n par Montgomery sur les limbes (n impair > 1, M >= 0)
+ *
+ * Fenêtre fixe de 4 bits de gauche à droite: 4 carrés et un produit par
+ * tranche de 4 bits de l'exposant, au lieu d'un carré et d'un produit
+ * par bit à 1.
+ */
+static BigBinary expModMontgomery(BigBinary M, BigBinary e, BigBinary n) {
+    // Module de 1024, 2048, 3072 ou 4096 bits exactement: tout sur la pile
+    int kFixe = (n.Taille + 63) / 64, i = indiceTailleFixe(kFixe);
+    if (i >= 0 && limbesTaillesFixes[i] == kFixe && M.Taille <= 64 * kFixe) {
+        uint64_t base[64], module[64], r[64];
+        chargeLimbes(M, base, kFixe);
+        chargeLimbes(n, module, kFixe);
+        noyaux.fixes[i].expMod(r, base, module, e);
+        return depuisLimbes(r, kFixe, 1);
+    }
+
+    int k, nm;
+    uint64_t *nl = versLimbes(n, &k);
+    uint64_t *m = versLimbes(M, &nm);
+
+    // -n^-1 mod 2^64 par Newton (n impair)
+    uint64_t inverse = nl[0];
+    for (int i = 0; i < 5; ++i) inverse *= 2 - nl[0] * inverse;
+    uint64_t nInverse = 0 - inverse;
+
+    const int nbPuissances = 1 << FENETRE_EXPOSANT;
+    uint64_t *table = alloueLimbes((size_t)k * nbPuissances);
+    uint64_t *acc = alloueLimbes(k);
+    uint64_t *t = alloueLimbes(2 * k);
+
+    // table[0] = R mod n, table[1] = M * R mod n (R = 2^(64k))
+    int nu = nm + k;
+    uint64_t *u = alloueLimbesZero(nu);
+    u[k] = 1;
+    divLimbes(NULL, table, u, k + 1, nl, k);
+    memset(u, 0, sizeof(uint64_t) * nu);
+    memcpy(u + k, m, sizeof(uint64_t) * nm);
+    divLimbes(NULL, table + k, u, nu, nl, k);
+    libereLimbes(u, nu);
+
+    for (int j = 2; j < nbPuissances; ++j) {
+        produitMontgomery(table + (size_t)k * j, table + (size_t)k * (j - 1), table + k, nl,
+                          nInverse, k, t);
+    }
+
+    int nbFenetres = (e.Taille + FENETRE_EXPOSANT - 1) / FENETRE_EXPOSANT;
+    memcpy(acc, table + (size_t)k * chiffreExposant(e, nbFenetres - 1), sizeof(uint64_t) * k);
+    for (int f = nbFenetres - 2; f >= 0; --f) {
+        for (int c = 0; c < FENETRE_EXPOSANT; ++c) {
+            produitMontgomery(acc, acc, acc, nl, nInverse, k, t);
+        }
+        int chiffre = chiffreExposant(e, f);
+        if (chiffre != 0) {
+            produitMontgomery(acc, acc, table + (size_t)k * chiffre, nl, nInverse, k, t);
+        }
+    }
+
+    // Sortie du domaine de Montgomery: réduction de acc seul
+    memset(t, 0, sizeof(uint64_t) * 2 * k);
+    memcpy(t, acc, sizeof(uint64_t) * k);
+    noyaux.redc(acc, t, nl, nInverse, k);
+    BigBinary resultat = depuisLimbes(acc, k, 1);
+
+    libereLimbes(t, 2 * k);
+    libereLimbes(acc, k);
+    libereLimbes(table, (size_t)k * nbPuissances);
+    libereLimbes(m, nm);
+    libereLimbes(nl, k);
+    return resultat;
+}
+
+// ============================================================================
+// =============== AJOUT: OPÉRATIONS AVEC UN ENTIER NATIF (64 bits) ===========
+// ============================================================================
+
+/**
+ * \brief Additionne un entier natif: A + u
+ * \param A BigBinary (signé)
+ * \param u Entier non signé 64 bits
+ * \return Nouveau BigBinary égal à A + u
+ *
+ * u est présenté à Addition comme une vue sur un tableau de la pile:
+ * aucune allocation ni conversion décimale pour l'opérande natif.
+ */
+BigBinary Addition_ui(BigBinary A, uint64_t u) {
+    int bits[64];
+    return Addition(A, vueDepuisU64(u, bits));
+}
+
+/**
+ * \brief Soustrait un entier natif: A - u
+ * \param A BigBinary (signé)
+ * \param u Entier non signé 64 bits
+ * \return Nouveau BigBinary égal à A - u (négatif si A < u)
+ */
+BigBinary Soustraction_ui(BigBinary A, uint64_t u) {
+    int bits[64];
+    return Soustraction(A, vueDepuisU64(u, bits));
+}
+
+/**
+ * \brief Multiplie par un entier natif: A * u
+ * \param A BigBinary (signé)
+ * \param u Entier non signé 64 bits
+ * \return Nouveau BigBinary égal à A * u
+ *
+ * Une seule passe sur les limbes de A: chaque limbe est multiplié par u
+ * (produit 128 bits) et la partie haute sert de retenue au suivant.
+ */
+BigBinary Multiplication_ui(BigBinary A, uint64_t u) {
+    if (A.Signe == 0 || u == 0) return creerZero();
+
+    int n;
+    uint64_t *limbes = versLimbes(A, &n);
+    uint64_t *produit = alloueLimbes(n + 1);
+
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t haut;
+        uint64_t bas = mul64(limbes[i], u, &haut);
+        bas += retenue;
+        haut += (bas < retenue);  // Retenue de l'addition
+        produit[i] = bas;
+        retenue = haut;
+    }
+    produit[n] = retenue;
+
+    BigBinary resultat = depuisLimbes(produit, n + 1, A.Signe);
+    libereLimbes(limbes, n);
+    libereLimbes(produit, n + 1);
+    return resultat;
+}
+
+/**
+ * \brief Division euclidienne par un entier natif
+ * \param A Dividende (signé)
+ * \param d Diviseur non nul
+ * \param reste Reçoit |A| mod d (peut être NULL)
+ * \return Quotient |A| / d, avec le signe de A
+ *
+ * Parcourt les limbes du poids fort au poids faible: le reste partiel
+ * (toujours < d) et le limbe courant forment un dividende de 128 bits,
+ * divisé grâce à l'inverse précalculé de d (voir preparerDiviseurNatif).
+ */
+BigBinary DivisionEuclidienne_ui(BigBinary A, uint64_t d, uint64_t *reste) {
+    if (d == 0) {
+        fprintf(stderr, "Erreur: Division par zéro dans DivisionEuclidienne_ui\n");
+        if (reste) *reste = 0;
+        return creerZero();
+    }
+
+    DiviseurNatif dn = preparerDiviseurNatif(d);
+    return DivisionEuclidienne_pre(A, &dn, reste);
+}
+
+/**
+ * \brief Reste de la division par un entier natif: |A| mod d
+ * \param A BigBinary (seule la magnitude est utilisée)
+ * \param d Diviseur non nul
+ * \return |A| mod d sous forme d'entier natif
+ *
+ * Même parcours que DivisionEuclidienne_ui, sans construire le quotient.
+ */
+uint64_t Modulo_ui(BigBinary A, uint64_t d) {
+    if (d == 0) {
+        fprintf(stderr, "Erreur: Division par zéro dans Modulo_ui\n");
+        return 0;
+    }
+
+    DiviseurNatif dn = preparerDiviseurNatif(d);
+    return Modulo_pre(A, &dn);
+}
+
+// ============================================================================
+// ========== AJOUT: DIVISION PAR UN MOT AVEC INVERSE PRÉCALCULÉ ==============
+// ============================================================================
+
+/*
+ * Division 2 mots / 1 mot par inverse précalculé (Möller & Granlund,
+ * "Improved division by invariant integers", 2011).
+ *
+ * Le diviseur est d'abord normalisé (décalé pour que son bit 63 soit à 1),
+ * puis on calcule une fois v = floor((2^128 - 1) / dn) - 2^64. Chaque
+ * division ne coûte ensuite que deux multiplications et quelques
+ * corrections, au lieu d'une instruction de division matérielle lente.
+ */
+
+/**
+ * \brief Prépare un diviseur natif pour des divisions répétées
+ * \param d Diviseur non nul
+ * \return Structure contenant le diviseur normalisé et son inverse
+ *
+ * Le coût (une vraie division 128/64) est payé une seule fois par
+ * diviseur: à réutiliser pour tous les nombres réduits modulo d.
+ */
+DiviseurNatif preparerDiviseurNatif(uint64_t d) {
+    DiviseurNatif dn;
+    dn.d = d;
+    if (d == 0) {
+        dn.decalage = 0;
+        dn.normalise = 0;
+        dn.inverse = 0;
+        return dn;
+    }
+
+    dn.decalage = zerosTete64(d);
+    dn.normalise = d << dn.decalage;
+
+    // v = floor((2^128 - 1) / dn) - 2^64 = floor(((~dn) * 2^64 + 2^64 - 1) / dn)
+    uint64_t reste;
+    dn.inverse = div128(~dn.normalise, ~(uint64_t)0, dn.normalise, &reste);
+    return dn;
+}
+
+/**
+ * \brief Divise (u1 * 2^64 + u0) par le diviseur normalisé, avec u1 < dn
+ * \param u1 Mot de poids fort (doit être < dn->normalise)
+ * \param u0 Mot de poids faible
+ * \param dn Diviseur préparé
+ * \param reste Reçoit le reste (< dn->normalise)
+ * \return Le quotient
+ */
+static inline uint64_t divise2par1(uint64_t u1, uint64_t u0,
+                                   const DiviseurNatif *dn, uint64_t *reste) {
+    const uint64_t d = dn->normalise;
+
+    // (q1, q0) = v * u1 + (u1 + 1, u0)
+    uint64_t q1;
+    uint64_t q0 = mul64(dn->inverse, u1, &q1);
+    q0 += u0;
+    q1 += u1 + 1 + (q0 < u0);
+
+    // Reste candidat, corrigé au plus deux fois
+    uint64_t r = u0 - q1 * d;
+    if (r > q0) {
+        q1--;
+        r += d;
+    }
+    if (r >= d) {
+        q1++;
+        r -= d;
+    }
+    *reste = r;
+    return q1;
+}
+
+/**
+ * \brief Une étape de division: (r * 2^64 + limbe) / d avec r < d
+ * \param r Reste courant (< d), mis à jour
+ * \param limbe Mot suivant du dividende
+ * \param dn Diviseur préparé
+ * \return Le chiffre de quotient correspondant à ce limbe
+ *
+ * On divise (r * 2^64 + limbe) * 2^s par dn = d * 2^s: le quotient est
+ * le même et le reste est simplement décalé de s bits. Les s bits de
+ * tête du limbe passent dans le mot de poids fort, qui reste < dn.
+ */
+static inline uint64_t etapeDivision(uint64_t *r, uint64_t limbe, const DiviseurNatif *dn) {
+    int s = dn->decalage;
+    uint64_t u1 = (s == 0) ? *r : (*r << s) | (limbe >> (64 - s));
+    uint64_t u0 = limbe << s;
+
+    uint64_t resteNormalise;
+    uint64_t q = divise2par1(u1, u0, dn, &resteNormalise);
+    *r = resteNormalise >> s;
+    return q;
+}
+
+/**
+ * \brief Division euclidienne par un diviseur natif préparé
+ * \param A Dividende (signé)
+ * \param dn Diviseur préparé par preparerDiviseurNatif()
+ * \param reste Reçoit |A| mod d (peut être NULL)
+ * \return Quotient |A| / d, avec le signe de A
+ */
+BigBinary DivisionEuclidienne_pre(BigBinary A, const DiviseurNatif *dn, uint64_t *reste) {
+    if (dn->d == 0) {
+        fprintf(stderr, "Erreur: Division par zéro dans DivisionEuclidienne_pre\n");
+        if (reste) *reste = 0;
+        return creerZero();
+    }
+
+    int n;
+    uint64_t *limbes = versLimbes(A, &n);
+
+    uint64_t r = 0;
+    for (int i = n - 1; i >= 0; --i) {
+        limbes[i] = etapeDivision(&r, limbes[i], dn);  // Quotient en place
+    }
+
+    BigBinary quotient = depuisLimbes(limbes, n, A.Signe);
+    libereLimbes(limbes, n);
+    if (reste) *reste = r;
+    return quotient;
+}
+
+/**
+ * \brief Reste de la division par un diviseur natif préparé: |A| mod d
+ * \param A BigBinary (seule la magnitude est utilisée)
+ * \param dn Diviseur préparé par preparerDiviseurNatif()
+ * \return |A| mod d
+ */
+uint64_t Modulo_pre(BigBinary A, const DiviseurNatif *dn) {
+    if (dn->d == 0) {
+        fprintf(stderr, "Erreur: Division par zéro dans Modulo_pre\n");
+        return 0;
+    }
+
+    int n;
+    uint64_t *limbes = versLimbes(A, &n);
+
+    uint64_t r = 0;
+    for (int i = n - 1; i >= 0; --i) {
+        etapeDivision(&r, limbes[i], dn);
+    }
+
+    libereLimbes(limbes, n);
+    return r;
+}
+
+/**
+ * \brief Réduit un BigBinary modulo toute une table de diviseurs en une passe
+ * \param A BigBinary (seule la magnitude est utilisée)
+ * \param table Diviseurs préparés (tous non nuls)
+ * \param nb Nombre de diviseurs dans la table
+ * \param restes Tableau de nb cases recevant |A| mod table[j].d
+ *
+ * === AJOUT: Crible / division d'essai ===
+ *
+ * A n'est converti en limbes qu'une seule fois. On parcourt ensuite ses
+ * limbes du poids fort au poids faible, et chaque limbe lu fait avancer
+ * les restes de tous les diviseurs: le nombre n'est lu qu'une fois,
+ * quel que soit le nombre de petits premiers testés.
+ */
+void ModuloMultiple_pre(BigBinary A, const DiviseurNatif *table, int nb, uint64_t *restes) {
+    for (int j = 0; j < nb; ++j) restes[j] = 0;
+
+    int n;
+    uint64_t *limbes = versLimbes(A, &n);
+
+    for (int i = n - 1; i >= 0; --i) {
+        uint64_t limbe = limbes[i];
+        for (int j = 0; j < nb; ++j) {
+            if (table[j].d != 0) etapeDivision(&restes[j], limbe, &table[j]);
+        }
+    }
+
+    libereLimbes(limbes, n);
+}
+
+// ============================================================================
+// ================ AJOUT: CONVERSIONS DÉCIMALES DE TAILLE LIBRE ==============
+// ============================================================================
+
+/*
+ * Les conversions travaillent en base 10^19: c'est la plus grande
+ * puissance de 10 qui tient dans un limbe de 64 bits, donc 19 chiffres
+ * décimaux sont traités à chaque opération sur un mot.
+ *
+ * - Petits nombres: méthode par blocs (Horner en base 10^19 pour la
+ *   lecture, divisions successives par 10^19 pour l'écriture).
+ * - Grands nombres: diviser pour régner. Le nombre est coupé autour
+ *   d'une puissance 10^(19 * 2^j); ces puissances sont calculées une
+ *   seule fois par conversion (par élévations au carré) puis réutilisées
+ *   à chaque niveau de la récursion.
+ * - À l'écriture, les grandes puissances gardent aussi leur inverse
+ *   (Newton): chaque coupure est une division de Barrett, faite de
+ *   produits Karatsuba, et non une division scolaire en O(n^2).
+ */
+
+#define CHIFFRES_PAR_LIMBE 19
+#define DIX_PUISSANCE_19 10000000000000000000ULL
+
+// Nombre de limbes en dessous duquel la méthode par blocs est utilisée
+#define SEUIL_DECIMAL_DC 32
+
+// Taille (en limbes) de puissance de 10 à partir de laquelle l'écriture
+// divise par Barrett plutôt que par division scolaire
+#define SEUIL_DECIMAL_BARRETT 64
+
+// Nombre maximal de puissances 10^(19 * 2^j) mises en cache
+#define MAX_PUISSANCES_DIX 40
+
+// Cache des puissances 10^(19 * 2^j) pour une conversion
+typedef struct {
+    uint64_t *limbes[MAX_PUISSANCES_DIX];
+    int taille[MAX_PUISSANCES_DIX];
+    int capacite[MAX_PUISSANCES_DIX];  // Limbes alloués (pour la libération)
+    uint64_t *normalise[MAX_PUISSANCES_DIX];  // Puissance décalée (bit de tête à 1)
+    uint64_t *inverse[MAX_PUISSANCES_DIX];    // Son inverse, NULL tant qu'inutile
+    int decalage[MAX_PUISSANCES_DIX];
+    int nb;  // Nombre de puissances déjà calculées
+} PuissancesDix;
+
+/**
+ * \brief Renvoie 10^(19 * 2^j) depuis le cache, en le complétant si besoin
+ */
+static const uint64_t *puissanceDix(PuissancesDix *cache, int j, int *taille) {
+    if (cache->nb == 0) {
+        cache->limbes[0] = alloueLimbes(1);
+        cache->limbes[0][0] = DIX_PUISSANCE_19;
+        cache->taille[0] = 1;
+        cache->capacite[0] = 1;
+        cache->inverse[0] = NULL;
+        cache->nb = 1;
+    }
+    while (cache->nb <= j) {
+        // 10^(19 * 2^(k+1)) = (10^(19 * 2^k))^2
+        int k = cache->nb - 1;
+        int n = cache->taille[k];
+        uint64_t *carre = alloueLimbes(2 * n);
+        mulLimbes(carre, cache->limbes[k], n, cache->limbes[k], n);
+        int nc = 2 * n;
+        while (nc > 1 && carre[nc - 1] == 0) nc--;
+        cache->limbes[k + 1] = carre;
+        cache->taille[k + 1] = nc;
+        cache->capacite[k + 1] = 2 * n;
+        cache->inverse[k + 1] = NULL;
+        cache->nb++;
+    }
+    *taille = cache->taille[j];
+    return cache->limbes[j];
+}
+
+/**
+ * \brief Libère les puissances de 10 mises en cache
+ */
+static void liberePuissancesDix(PuissancesDix *cache) {
+    for (int j = 0; j < cache->nb; ++j) {
+        libereLimbes(cache->limbes[j], cache->capacite[j]);
+        if (cache->inverse[j] != NULL) {
+            libereLimbes(cache->normalise[j], cache->taille[j]);
+            libereLimbes(cache->inverse[j], cache->taille[j] + 1);
+        }
+    }
+    cache->nb = 0;
+}
+
+/**
+ * \brief Prépare la division par 10^(19 * 2^j): puissance normalisée et son inverse
+ *
+ * Le niveau j doit déjà être dans le cache (puissanceDix).
+ */
+static void preparerInverseDix(PuissancesDix *cache, int j) {
+    if (cache->inverse[j] != NULL) return;
+    int n = cache->taille[j];
+    const uint64_t *p = cache->limbes[j];
+    int s = 0;
+    for (uint64_t t = p[n - 1]; !(t & 0x8000000000000000ULL); t <<= 1) s++;
+
+    uint64_t *normalise = alloueLimbes(n);
+    for (int i = n - 1; i > 0; --i) {
+        normalise[i] = (p[i] << s) | (s ? p[i - 1] >> (64 - s) : 0);
+    }
+    normalise[0] = p[0] << s;
+
+    cache->inverse[j] = alloueLimbes(n + 1);
+    inverseLimbes(cache->inverse[j], normalise, n);
+    cache->normalise[j] = normalise;
+    cache->decalage[j] = s;
+}
+
+/**
+ * \brief Lecture par blocs de 19 chiffres (Horner en base 10^19)
+ * \param res Limbes du résultat (au moins len / 19 + 1 cases)
+ * \param chiffres Chiffres décimaux ('0' à '9' uniquement)
+ * \param len Nombre de chiffres
+ * \return Nombre de limbes utilisés
+ */
+static int lectureDecimaleBlocs(uint64_t *res, const char *chiffres, int len) {
+    int n = 0;
+    int pos = 0;
+
+    // Premier bloc de len % 19 chiffres, puis des blocs complets
+    int bloc = len % CHIFFRES_PAR_LIMBE;
+    if (bloc == 0) bloc = CHIFFRES_PAR_LIMBE;
+
+    while (pos < len) {
+        uint64_t valeur = 0, puissance = 1;
+        for (int i = 0; i < bloc; ++i) {
+            valeur = valeur * 10 + (uint64_t)(chiffres[pos + i] - '0');
+            puissance *= 10;
+        }
+        pos += bloc;
+        bloc = CHIFFRES_PAR_LIMBE;
+
+        // res = res * 10^bloc + valeur
+        uint64_t retenue = valeur;
+        for (int i = 0; i < n; ++i) {
+            uint64_t haut;
+            uint64_t bas = mul64(res[i], puissance, &haut);
+            bas += retenue;
+            haut += (bas < retenue);
+            res[i] = bas;
+            retenue = haut;
+        }
+        if (retenue) res[n++] = retenue;
+    }
+    return n;
+}
+
+/**
+ * \brief Lecture récursive: valeur = haut * 10^k + bas
+ * \return Nombre de limbes utilisés dans res (au moins len / 19 + 2 cases)
+ */
+static int lectureDecimaleRec(uint64_t *res, const char *chiffres, int len,
+                              PuissancesDix *cache) {
+    if (len <= CHIFFRES_PAR_LIMBE * SEUIL_DECIMAL_DC) {
+        return lectureDecimaleBlocs(res, chiffres, len);
+    }
+
+    // Plus grand k = 19 * 2^j strictement inférieur à len
+    int j = 0;
+    while ((long)CHIFFRES_PAR_LIMBE << (j + 1) < len) j++;
+    int k = CHIFFRES_PAR_LIMBE << j;
+
+    // Partie haute (len - k chiffres) et partie basse (k chiffres)
+    int capHaut = (len - k) / CHIFFRES_PAR_LIMBE + 2;
+    int capBas = k / CHIFFRES_PAR_LIMBE + 2;
+    uint64_t *haut = alloueLimbes(capHaut);
+    uint64_t *bas = alloueLimbes(capBas);
+    int nh = lectureDecimaleRec(haut, chiffres, len - k, cache);
+    int nb = lectureDecimaleRec(bas, chiffres + len - k, k, cache);
+
+    int np;
+    const uint64_t *p = puissanceDix(cache, j, &np);
+
+    // res = haut * 10^k + bas. Comme haut >= 1 et bas < 10^k, la somme
+    // est < (haut + 1) * 10^k et tient donc dans les nh + np limbes
+    mulLimbes(res, haut, nh, p, np);
+    int n = nh + np;
+    propageRetenue(res + nb, n - nb, noyaux.ajoute(res, bas, nb));
+    while (n > 0 && res[n - 1] == 0) n--;
+
+    libereLimbes(haut, capHaut);
+    libereLimbes(bas, capBas);
+    return n;
+}
+
+/**
+ * \brief Crée un BigBinary depuis une chaîne décimale de taille quelconque
+ * \param chaine Chaîne décimale, éventuellement précédée de '-' ou '+'
+ * \return Un BigBinary représentant le nombre
+ *
+ * === AJOUT: Conversion décimal vers binaire (taille libre) ===
+ *
+ * Comme creerBigBinaryDepuisChaine, les caractères autres que les
+ * chiffres sont ignorés (espaces, séparateurs de milliers...).
+ */
+BigBinary creerBigBinaryDepuisChaineDecimale(const char *chaine) {
+    // Signe éventuel (après les espaces de tête)
+    while (*chaine == ' ' || *chaine == '\t') chaine++;
+    int signe = +1;
+    if (*chaine == '-' || *chaine == '+') {
+        if (*chaine == '-') signe = -1;
+        chaine++;
+    }
+
+    // Extraire les chiffres, sans les zéros de tête
+    int n = strlen(chaine);
+    char *chiffres = alloueTampon((size_t)n + 1);
+    int len = 0;
+    for (int i = 0; i < n; ++i) {
+        if (chaine[i] >= '0' && chaine[i] <= '9') {
+            if (len == 0 && chaine[i] == '0') continue;
+            chiffres[len++] = chaine[i];
+        }
+    }
+    if (len == 0) {
+        libereTampon(chiffres, (size_t)n + 1);
+        return creerZero();
+    }
+
+    PuissancesDix cache;
+    cache.nb = 0;
+    size_t capacite = (size_t)len / CHIFFRES_PAR_LIMBE + 2;
+    uint64_t *limbes = alloueLimbes(capacite);
+    int nl = lectureDecimaleRec(limbes, chiffres, len, &cache);
+
+    BigBinary nb = depuisLimbes(limbes, nl, signe);
+
+    liberePuissancesDix(&cache);
+    libereLimbes(limbes, capacite);
+    libereTampon(chiffres, (size_t)n + 1);
+    return nb;
+}
+
+/**
+ * \brief Écriture par divisions successives par 10^19
+ * \param dest Zone de sortie (chiffres écrits sans '\0')
+ * \param x Limbes du nombre (modifiés: le nombre est consommé)
+ * \param n Nombre de limbes
+ * \param largeur Nombre exact de chiffres à écrire (zéros de tête), 0 = libre
+ * \param dix19 Diviseur 10^19 préparé
+ * \return Nombre de chiffres écrits
+ */
+static int ecritureDecimaleBlocs(char *dest, uint64_t *x, int n, int largeur,
+                                 const DiviseurNatif *dix19) {
+    // Les chiffres sont produits du poids faible vers le poids fort
+    int capacite = (n + 1) * CHIFFRES_PAR_LIMBE + largeur;
+    char *inverse = alloueTampon(capacite);
+    int pos = 0;
+
+    while (n > 0 && x[n - 1] == 0) n--;
+    while (n > 0) {
+        uint64_t r = 0;
+        for (int i = n - 1; i >= 0; --i) {
+            x[i] = etapeDivision(&r, x[i], dix19);
+        }
+        while (n > 0 && x[n - 1] == 0) n--;
+
+        if (n > 0) {
+            // Bloc intérieur: exactement 19 chiffres
+            for (int i = 0; i < CHIFFRES_PAR_LIMBE; ++i) {
+                inverse[pos++] = (char)('0' + r % 10);
+                r /= 10;
+            }
+        } else {
+            // Bloc de tête: sans zéros inutiles
+            while (r > 0) {
+                inverse[pos++] = (char)('0' + r % 10);
+                r /= 10;
+            }
+        }
+    }
+    while (pos < largeur) inverse[pos++] = '0';
+
+    for (int i = 0; i < pos; ++i) dest[i] = inverse[pos - 1 - i];
+    libereTampon(inverse, capacite);
+    return pos;
+}
+
+/**
+ * \brief Écriture récursive: x = q * 10^k + r, q puis r sur k chiffres
+ * \return Nombre de chiffres écrits
+ */
+static int ecritureDecimaleRec(char *dest, uint64_t *x, int n, int largeur,
+                               PuissancesDix *cache, const DiviseurNatif *dix19) {
+    while (n > 0 && x[n - 1] == 0) n--;
+    if (n <= SEUIL_DECIMAL_DC) {
+        return ecritureDecimaleBlocs(dest, x, n, largeur, dix19);
+    }
+
+    // Plus grande puissance 10^(19 * 2^j) d'environ la moitié de x
+    int j = 0, np;
+    puissanceDix(cache, 0, &np);
+    while (1) {
+        int npSuivant;
+        puissanceDix(cache, j + 1, &npSuivant);
+        if (2 * npSuivant > n + 1) break;
+        j++;
+    }
+    const uint64_t *p = puissanceDix(cache, j, &np);
+    int k = CHIFFRES_PAR_LIMBE << j;
+
+    // x = q * 10^k + r
+    int nq = n - np + 2;
+    uint64_t *q = alloueLimbes(nq);
+    uint64_t *r = alloueLimbes(np);
+    if (np < SEUIL_DECIMAL_BARRETT) {
+        q[nq - 1] = 0;
+        divLimbes(q, r, x, n, p, np);
+    } else {
+        // Barrett sur x * 2^s et 10^k * 2^s: même quotient, reste décalé
+        preparerInverseDix(cache, j);
+        int s = cache->decalage[j];
+        uint64_t *xs = alloueLimbes(n + 1);
+        xs[n] = s ? x[n - 1] >> (64 - s) : 0;
+        for (int i = n - 1; i > 0; --i) {
+            xs[i] = (x[i] << s) | (s ? x[i - 1] >> (64 - s) : 0);
+        }
+        xs[0] = x[0] << s;
+        divLimbesBarrett(q, r, xs, n + 1, cache->normalise[j], cache->inverse[j], np);
+        decaleDroiteLimbes(r, np, s);
+        libereLimbes(xs, n + 1);
+    }
+
+    // Partie haute (largeur restante), puis partie basse sur k chiffres
+    int largeurHaut = (largeur > k) ? largeur - k : 0;
+    int pos = ecritureDecimaleRec(dest, q, nq, largeurHaut, cache, dix19);
+    pos += ecritureDecimaleRec(dest + pos, r, np, k, cache, dix19);
+
+    libereLimbes(q, nq);
+    libereLimbes(r, np);
+    return pos;
+}
+
+/**
+ * \brief Convertit un BigBinary en chaîne décimale
+ * \param nb BigBinary à convertir
+ * \return Chaîne allouée (à libérer avec free), avec '-' si négatif
+ *
+ * === AJOUT: Conversion binaire vers décimal (taille libre) ===
+ */
+char *BigBinaryVersChaineDecimale(BigBinary nb) {
+    if (nb.Signe == 0) {
+        char *zero = malloc(2);
+        zero[0] = '0';
+        zero[1] = '\0';
+        return zero;
+    }
+
+    // log10(2) < 0.30103: nombre de chiffres <= Taille * 0.30103 + 1
+    int maxChiffres = (int)((long long)nb.Taille * 30103 / 100000) + 2;
+    char *resultat = malloc(maxChiffres + 2);
+    int pos = 0;
+    if (nb.Signe < 0) resultat[pos++] = '-';
+
+    int n;
+    uint64_t *limbes = versLimbes(nb, &n);
+
+    PuissancesDix cache;
+    cache.nb = 0;
+    DiviseurNatif dix19 = preparerDiviseurNatif(DIX_PUISSANCE_19);
+    pos += ecritureDecimaleRec(resultat + pos, limbes, n, 0, &cache, &dix19);
+    resultat[pos] = '\0';
+
+    liberePuissancesDix(&cache);
+    libereLimbes(limbes, n);
+    return resultat;
+}
+
+/**
+ * \brief Affiche un BigBinary en décimal
+ * \param nb BigBinary à afficher
+ */
+void afficheBigBinaryDecimal(BigBinary nb) {
+    char *chaine = BigBinaryVersChaineDecimale(nb);
+    printf("%s\n", chaine);
+    free(chaine);
+}
+
+// ============================================================================
+// ============== AJOUT: IMPORT / EXPORT HEXADÉCIMAL ET OCTETS BRUTS ==========
+// ============================================================================
+
+/*
+ * Avec le stockage MSB en premier, un chiffre hexadécimal correspond à
+ * 4 cases consécutives et un octet à 8 cases: la conversion est un
+ * simple éclatement (ou regroupement) de bits, sans arithmétique.
+ */
+
+/**
+ * \brief Valeur d'un chiffre hexadécimal (-1 si le caractère n'en est pas un)
+ */
+static inline int valeurHexa(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * \brief Écrit les 8 bits d'un octet dans 8 cases (MSB en premier)
+ */
+static inline void eclateOctet(int *bits, unsigned int octet) {
+    bits[0] = (octet >> 7) & 1;
+    bits[1] = (octet >> 6) & 1;
+    bits[2] = (octet >> 5) & 1;
+    bits[3] = (octet >> 4) & 1;
+    bits[4] = (octet >> 3) & 1;
+    bits[5] = (octet >> 2) & 1;
+    bits[6] = (octet >> 1) & 1;
+    bits[7] = octet & 1;
+}
+
+/**
+ * \brief Regroupe 8 cases (MSB en premier) en un octet
+ */
+static inline uint8_t regroupeOctet(const int *bits) {
+    return (uint8_t)((bits[0] << 7) | (bits[1] << 6) | (bits[2] << 5) | (bits[3] << 4) |
+                     (bits[4] << 3) | (bits[5] << 2) | (bits[6] << 1) | bits[7]);
+}
+
+/**
+ * \brief Crée un BigBinary depuis une chaîne hexadécimale
+ * \param chaine Chaîne hexadécimale, éventuellement précédée de '-' et/ou "0x"
+ * \return Un BigBinary représentant le nombre
+ *
+ * Chaque chiffre hexadécimal donne directement 4 bits. Comme pour
+ * creerBigBinaryDepuisChaine, les autres caractères sont ignorés.
+ */
+BigBinary creerBigBinaryDepuisHexa(const char *chaine) {
+    while (*chaine == ' ' || *chaine == '\t') chaine++;
+    int signe = +1;
+    if (*chaine == '-') {
+        signe = -1;
+        chaine++;
+    }
+    if (chaine[0] == '0' && (chaine[1] == 'x' || chaine[1] == 'X')) chaine += 2;
+
+    // Une seule passe: 4 bits par chiffre valide
+    int n = strlen(chaine);
+    BigBinary nb = initBigBinary(4 * n + 1, signe);
+    int taille = 0;
+    for (int i = 0; i < n; ++i) {
+        int v = valeurHexa(chaine[i]);
+        if (v < 0) continue;
+        nb.Tdigits[taille]     = (v >> 3) & 1;
+        nb.Tdigits[taille + 1] = (v >> 2) & 1;
+        nb.Tdigits[taille + 2] = (v >> 1) & 1;
+        nb.Tdigits[taille + 3] = v & 1;
+        taille += 4;
+    }
+    nb.Taille = (taille == 0) ? 1 : taille;
+
+    // Zéros de tête et détection du zéro
+    normaliser(&nb);
+    return nb;
+}
+
+/**
+ * \brief Convertit un BigBinary en chaîne hexadécimale (minuscules, sans "0x")
+ * \param nb BigBinary à convertir
+ * \return Chaîne allouée (à libérer avec free), avec '-' si négatif
+ */
+char *BigBinaryVersHexa(BigBinary nb) {
+    static const char chiffres[] = "0123456789abcdef";
+
+    if (nb.Signe == 0) {
+        char *zero = malloc(2);
+        zero[0] = '0';
+        zero[1] = '\0';
+        return zero;
+    }
+
+    int nbChiffres = (nb.Taille + 3) / 4;
+    char *resultat = malloc(nbChiffres + 2);
+    int pos = 0;
+    if (nb.Signe < 0) resultat[pos++] = '-';
+
+    // Premier chiffre: les Taille % 4 bits de tête (ou 4)
+    int tete = nb.Taille - 4 * (nbChiffres - 1);
+    int v = 0;
+    for (int i = 0; i < tete; ++i) v = (v << 1) | nb.Tdigits[i];
+    resultat[pos++] = chiffres[v];
+
+    // Chiffres suivants: 4 bits chacun
+    for (int i = tete; i < nb.Taille; i += 4) {
+        v = (nb.Tdigits[i] << 3) | (nb.Tdigits[i + 1] << 2) |
+            (nb.Tdigits[i + 2] << 1) | nb.Tdigits[i + 3];
+        resultat[pos++] = chiffres[v];
+    }
+    resultat[pos] = '\0';
+    return resultat;
+}
+
+/**
+ * \brief Crée un BigBinary (positif) depuis un tableau d'octets
+ * \param octets Octets du nombre
+ * \param n Nombre d'octets
+ * \param grosBoutiste true si octets[0] est l'octet de poids fort
+ *                     (big-endian), false s'il est de poids faible
+ * \return Un BigBinary représentant la magnitude
+ *
+ * Format brut des clés et messages chiffrés: 8 bits par octet, sans
+ * passer par une représentation texte.
+ */
+BigBinary creerBigBinaryDepuisOctets(const uint8_t *octets, size_t n, bool grosBoutiste) {
+    if (n == 0) return creerZero();
+
+    BigBinary nb = initBigBinary((int)(8 * n), 1);
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t octet = grosBoutiste ? octets[i] : octets[n - 1 - i];
+        eclateOctet(nb.Tdigits + 8 * i, octet);
+    }
+
+    normaliser(&nb);
+    return nb;
+}
+
+/**
+ * \brief Nombre d'octets nécessaires pour la magnitude d'un BigBinary
+ * \param nb BigBinary à mesurer
+ * \return (nombre de bits + 7) / 8, 0 pour le nombre nul
+ */
+size_t nombreOctets(BigBinary nb) {
+    return (size_t)(longueurBits(nb) + 7) / 8;
+}
+
+/**
+ * \brief Exporte la magnitude d'un BigBinary dans un tableau d'octets
+ * \param nb BigBinary à exporter
+ * \param dest Zone de sortie
+ * \param taille Taille de dest; la sortie est complétée par des zéros
+ *               de poids fort jusqu'à cette taille (format fixe)
+ * \param grosBoutiste true pour l'ordre big-endian, false pour little-endian
+ * \return Nombre d'octets écrits (taille), ou 0 si dest est trop petit
+ */
+size_t BigBinaryVersOctets(BigBinary nb, uint8_t *dest, size_t taille, bool grosBoutiste) {
+    size_t utiles = nombreOctets(nb);
+    if (utiles > taille) return 0;
+
+    // Octets de poids fort à zéro (remplissage jusqu'à la taille demandée)
+    size_t zeros = taille - utiles;
+    for (size_t i = 0; i < zeros; ++i) {
+        dest[grosBoutiste ? i : taille - 1 - i] = 0;
+    }
+    if (utiles == 0) return taille;
+
+    // Premier octet utile: les Taille % 8 bits de tête (ou 8)
+    int tete = nb.Taille - 8 * (int)(utiles - 1);
+    unsigned int v = 0;
+    for (int i = 0; i < tete; ++i) v = (v << 1) | (unsigned int)nb.Tdigits[i];
+
+    size_t k = zeros;  // Rang de l'octet courant, depuis le poids fort
+    dest[grosBoutiste ? k : taille - 1 - k] = (uint8_t)v;
+    k++;
+
+    // Octets complets suivants
+    for (int i = tete; i < nb.Taille; i += 8, ++k) {
+        dest[grosBoutiste ? k : taille - 1 - k] = regroupeOctet(nb.Tdigits + i);
+    }
+    return taille;
+}
+
+// ============================================================================
+// ========== AJOUT: FORMAT DE FICHIER BINAIRE ET CHARGEMENT PAR MMAP =========
+// ============================================================================
+
+/*
+ * Disposition du fichier (version 1), tous les champs dans l'ordre
+ * d'octets de la machine qui l'a écrit:
+ *
+ *   [en-tête 64 octets][index: nombre x 24 octets][données alignées sur 64]
+ *
+ * Deux dispositions des données sont possibles:
+ * - CASES:  le tableau Tdigits tel quel (un int par bit, MSB en premier).
+ *           À l'ouverture, chaque BigBinary pointe directement dans la
+ *           projection mémoire: aucun octet n'est copié ni converti.
+ * - LIMBES: mots de 64 bits, poids faible en premier (32 fois plus
+ *           compact, mais converti à l'ouverture).
+ */
+
+#define MAGIE_FICHIER "BIGBIN\r\n"
+#define VERSION_FICHIER 1u
+#define MARQUE_ORDRE_OCTETS 0x01020304u
+#define ALIGNEMENT_FICHIER 64
+#define DISPOSITION_CASES 0u
+#define DISPOSITION_LIMBES 1u
+
+// En-tête du fichier (64 octets)
+typedef struct {
+    char magie[8];          // MAGIE_FICHIER
+    uint32_t version;       // VERSION_FICHIER
+    uint32_t ordreOctets;   // MARQUE_ORDRE_OCTETS vue par l'écrivain
+    uint32_t disposition;   // DISPOSITION_CASES ou DISPOSITION_LIMBES
+    uint32_t tailleUnite;   // sizeof(int) ou sizeof(uint64_t)
+    uint64_t nombre;        // Nombre d'entiers stockés
+    uint8_t reserve[32];
+} EnTeteFichier;
+
+// Entrée de l'index (24 octets)
+typedef struct {
+    uint64_t position;  // Début des données depuis le début du fichier
+    uint64_t bits;      // Nombre de cases (Taille)
+    int32_t signe;
+    uint32_t reserve;
+} EntreeIndex;
+
+static inline uint64_t aligneSur64(uint64_t n) {
+    return (n + ALIGNEMENT_FICHIER - 1) & ~(uint64_t)(ALIGNEMENT_FICHIER - 1);
+}
+
+static inline uint32_t inverse32(uint32_t x) {
+    return (x >> 24) | ((x >> 8) & 0xFF00u) | ((x << 8) & 0xFF0000u) | (x << 24);
+}
+
+static inline uint64_t inverse64(uint64_t x) {
+    return ((uint64_t)inverse32((uint32_t)x) << 32) | inverse32((uint32_t)(x >> 32));
+}
+
+/**
+ * \brief Taille en octets des données d'un entier de 'bits' cases
+ */
+static uint64_t tailleDonnees(uint64_t bits, uint32_t disposition) {
+    if (disposition == DISPOSITION_CASES) return bits * sizeof(int);
+    return ((bits + 63) / 64) * sizeof(uint64_t);
+}
+
+/**
+ * \brief Écrit une table d'entiers dans un fichier binaire
+ * \param chemin Chemin du fichier à créer (écrasé s'il existe)
+ * \param nombres Entiers à écrire
+ * \param nb Nombre d'entiers
+ * \param compact true pour stocker des limbes de 64 bits (fichier 32 fois
+ *                plus petit), false pour le tableau Tdigits brut, qui
+ *                pourra être ouvert sans aucune copie
+ * \return true si l'écriture a réussi
+ */
+bool ecrireFichierBigBinary(const char *chemin, const BigBinary *nombres, size_t nb, bool compact) {
+    FILE *f = fopen(chemin, "wb");
+    if (f == NULL) return false;
+
+    uint32_t disposition = compact ? DISPOSITION_LIMBES : DISPOSITION_CASES;
+    static const uint8_t zeros[ALIGNEMENT_FICHIER] = {0};
+    bool ok = true;
+
+    EnTeteFichier entete;
+    memset(&entete, 0, sizeof(entete));
+    memcpy(entete.magie, MAGIE_FICHIER, sizeof(entete.magie));
+    entete.version = VERSION_FICHIER;
+    entete.ordreOctets = MARQUE_ORDRE_OCTETS;
+    entete.disposition = disposition;
+    entete.tailleUnite = compact ? sizeof(uint64_t) : sizeof(int);
+    entete.nombre = nb;
+    ok = ok && fwrite(&entete, sizeof(entete), 1, f) == 1;
+
+    // Index: les positions se déduisent des tailles, chaque bloc étant aligné
+    uint64_t position = aligneSur64(sizeof(EnTeteFichier) + nb * sizeof(EntreeIndex));
+    for (size_t i = 0; ok && i < nb; ++i) {
+        EntreeIndex entree;
+        memset(&entree, 0, sizeof(entree));
+        entree.position = position;
+        entree.bits = (uint64_t)nombres[i].Taille;
+        entree.signe = nombres[i].Signe;
+        ok = fwrite(&entree, sizeof(entree), 1, f) == 1;
+        position = aligneSur64(position + tailleDonnees(entree.bits, disposition));
+    }
+
+    // Données, chacune suivie de son remplissage
+    uint64_t ecrit = sizeof(EnTeteFichier) + nb * sizeof(EntreeIndex);
+    for (size_t i = 0; ok && i <= nb; ++i) {
+        uint64_t bourrage = aligneSur64(ecrit) - ecrit;
+        if (bourrage > 0) ok = fwrite(zeros, 1, bourrage, f) == bourrage;
+        ecrit += bourrage;
+        if (!ok || i == nb) break;
+
+        if (compact) {
+            int n;
+            uint64_t *limbes = versLimbes(nombres[i], &n);
+            ok = fwrite(limbes, sizeof(uint64_t), n, f) == (size_t)n;
+            ecrit += (uint64_t)n * sizeof(uint64_t);
+            libereLimbes(limbes, n);
+        } else {
+            size_t n = (size_t)nombres[i].Taille;
+            ok = fwrite(nombres[i].Tdigits, sizeof(int), n, f) == n;
+            ecrit += n * sizeof(int);
+        }
+    }
+
+    if (fclose(f) != 0) ok = false;
+    return ok;
+}
+
+/**
+ * \brief Vrai si chaque case vaut 0 ou 1 (lecture seule, sans branchement par case)
+ */
+static bool casesBinaires(const int *cases, int taille) {
+    unsigned int ou = 0;
+    for (int i = 0; i < taille; ++i) ou |= (unsigned int)cases[i];
+    return (ou & ~1u) == 0;
+}
+
+/**
+ * \brief Construit une copie de Tdigits écrite dans l'ordre d'octets inverse
+ * \return Copie normalisée comme vueBigBinary: sans zéros de tête, nulle
+ *         (Signe 0) si toutes les cases sont nulles
+ */
+static BigBinary copieCasesInversees(const uint32_t *cases, int taille, int signe) {
+    // Une case nulle l'est dans les deux ordres d'octets
+    while (taille > 0 && cases[0] == 0) {
+        cases++;
+        taille--;
+    }
+    if (taille == 0 || signe == 0) return creerZero();
+
+    BigBinary nb = initBigBinary(taille, signe);
+    for (int i = 0; i < taille; ++i) nb.Tdigits[i] = (int)inverse32(cases[i]);
+    return nb;
+}
+
+/**
+ * \brief Construit un BigBinary depuis des limbes stockés dans le fichier
+ */
+static BigBinary depuisLimbesFichier(const uint64_t *donnees, uint64_t bits, int signe, bool inverse) {
+    int n = (int)((bits + 63) / 64);
+    uint64_t *limbes = alloueLimbes((size_t)n);
+    for (int i = 0; i < n; ++i) limbes[i] = inverse ? inverse64(donnees[i]) : donnees[i];
+    BigBinary nb = depuisLimbes(limbes, n, signe);
+    libereLimbes(limbes, (size_t)n);
+    return nb;
+}
+
+/**
+ * \brief Projette le fichier en mémoire en lecture seule (ou le lit si mmap est absent)
+ */
+static void *projeterFichier(const char *chemin, size_t *taille, bool *projete) {
+#if BIGBINARY_MMAP
+    int fd = open(chemin, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    void *base = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            base = NULL;
+        } else {
+            *taille = (size_t)st.st_size;
+            *projete = true;
+        }
+    }
+    close(fd);  // La projection reste valide après fermeture
+    return base;
+#else
+    FILE *f = fopen(chemin, "rb");
+    if (f == NULL) return NULL;
+    void *base = NULL;
+    long n = -1;
+    if (fseek(f, 0, SEEK_END) == 0) n = ftell(f);
+    if (n > 0 && fseek(f, 0, SEEK_SET) == 0) {
+        base = allocationTentee(allocateurCourant(), (size_t)n, BIGBINARY_ALIGNEMENT_LIMBES);
+        if (base != NULL && fread(base, 1, (size_t)n, f) != (size_t)n) {
+            liberation(allocateurCourant(), base, (size_t)n, BIGBINARY_ALIGNEMENT_LIMBES);
+            base = NULL;
+        }
+    }
+    fclose(f);
+    if (base != NULL) {
+        *taille = (size_t)n;
+        *projete = false;
+    }
+    return base;
+#endif
+}
+
+/**
+ * \brief Ouvre un fichier écrit par ecrireFichierBigBinary()
+ * \param chemin Chemin du fichier
+ * \param fichier Reçoit les entiers lus (à refermer avec fermerFichierBigBinary)
+ * \return true si le fichier est valide
+ *
+ * Pour la disposition CASES dans l'ordre d'octets de la machine, le
+ * fichier est projeté avec mmap et fichier->nombres[i].Tdigits pointe
+ * directement dans la projection: l'ouverture ne coûte que la lecture
+ * de l'index et une vérification des cases. Ces vues sont en LECTURE
+ * SEULE: elles peuvent être passées à toutes les opérations qui prennent
+ * un BigBinary par valeur, mais ni libérées ni modifiées en place
+ * (libereBigBinary, normaliser, decaleGaucheEnPlace...). Sinon les
+ * entiers sont convertis et fichier->copies vaut true.
+ *
+ * Toutes les cases sont vérifiées (0 ou 1, une lecture séquentielle sans
+ * copie): un fichier corrompu est refusé au lieu d'injecter dans les
+ * noyaux des cases qui ne sont pas des bits. Les cases de tête nulles
+ * sont sautées (vues et copies normalisées, comme vueBigBinary) et le
+ * signe doit correspondre à la valeur: 0 pour un nombre nul, -1 ou 1 sinon.
+ */
+bool ouvrirFichierBigBinary(const char *chemin, FichierBigBinary *fichier) {
+    memset(fichier, 0, sizeof(*fichier));
+
+    size_t taille = 0;
+    bool projete = false;
+    uint8_t *base = projeterFichier(chemin, &taille, &projete);
+    if (base == NULL) return false;
+    fichier->base = base;
+    fichier->taille = taille;
+    fichier->projete = projete;
+    fichier->allocateur = allocateurCourant();
+
+    // Vérification de l'en-tête
+    EnTeteFichier entete;
+    if (taille < sizeof(entete)) goto invalide;
+    memcpy(&entete, base, sizeof(entete));
+    if (memcmp(entete.magie, MAGIE_FICHIER, sizeof(entete.magie)) != 0) goto invalide;
+
+    bool inverse = (entete.ordreOctets != MARQUE_ORDRE_OCTETS);
+    if (inverse) {
+        if (entete.ordreOctets != inverse32(MARQUE_ORDRE_OCTETS)) goto invalide;
+        entete.version = inverse32(entete.version);
+        entete.disposition = inverse32(entete.disposition);
+        entete.tailleUnite = inverse32(entete.tailleUnite);
+        entete.nombre = inverse64(entete.nombre);
+    }
+    if (entete.version != VERSION_FICHIER) goto invalide;
+    if (entete.disposition == DISPOSITION_CASES) {
+        if (entete.tailleUnite != sizeof(int)) goto invalide;
+    } else if (entete.disposition == DISPOSITION_LIMBES) {
+        if (entete.tailleUnite != sizeof(uint64_t)) goto invalide;
+    } else {
+        goto invalide;
+    }
+    if (entete.nombre > (taille - sizeof(entete)) / sizeof(EntreeIndex)) goto invalide;
+
+    size_t nb = (size_t)entete.nombre;
+    fichier->nb = nb;
+    fichier->copies = inverse || entete.disposition == DISPOSITION_LIMBES;
+    fichier->nombres = allocationTentee(fichier->allocateur, sizeof(BigBinary) * (nb > 0 ? nb : 1), ALIGNEMENT_NATUREL);
+    if (fichier->nombres == NULL) goto invalide;
+    memset(fichier->nombres, 0, sizeof(BigBinary) * (nb > 0 ? nb : 1));
+
+    const uint8_t *index = base + sizeof(entete);
+    for (size_t i = 0; i < nb; ++i) {
+        EntreeIndex entree;
+        memcpy(&entree, index + i * sizeof(entree), sizeof(entree));
+        if (inverse) {
+            entree.position = inverse64(entree.position);
+            entree.bits = inverse64(entree.bits);
+            entree.signe = (int32_t)inverse32((uint32_t)entree.signe);
+        }
+
+        // Bornes et alignement: le fichier ne doit jamais faire lire hors de la projection
+        uint64_t octets = tailleDonnees(entree.bits, entete.disposition);
+        if (entree.bits == 0 || entree.bits > INT_MAX) goto invalide;
+        if (entree.signe < -1 || entree.signe > 1) goto invalide;
+        if (entree.position % ALIGNEMENT_FICHIER != 0) goto invalide;
+        if (entree.position > taille || octets > taille - entree.position) goto invalide;
+
+        // Chaque nombre est construit avec un signe non nul, puis le signe lu
+        // est comparé à la valeur: 0 pour un nombre nul, -1 ou 1 sinon
+        const void *donnees = base + entree.position;
+        int signe = (entree.signe != 0) ? entree.signe : 1;
+        if (entete.disposition == DISPOSITION_LIMBES) {
+            fichier->nombres[i] = depuisLimbesFichier(donnees, entree.bits, signe, inverse);
+        } else if (inverse) {
+            fichier->nombres[i] = copieCasesInversees(donnees, (int)entree.bits, signe);
+            if (!casesBinaires(fichier->nombres[i].Tdigits, fichier->nombres[i].Taille)) goto invalide;
+        } else {
+            if (!casesBinaires(donnees, (int)entree.bits)) goto invalide;
+            // Vue directe sur la projection (zéro copie), sans ses zéros de tête
+            fichier->nombres[i] = vueBigBinary(donnees, (int)entree.bits, signe);
+        }
+        if (estNul(fichier->nombres[i]) != (entree.signe == 0)) goto invalide;
+    }
+    return true;
+
+invalide:
+    fermerFichierBigBinary(fichier);
+    return false;
+}
+
+/**
+ * \brief Referme un fichier ouvert par ouvrirFichierBigBinary()
+ * \param fichier Fichier à refermer (les vues deviennent invalides)
+ */
+void fermerFichierBigBinary(FichierBigBinary *fichier) {
+    if (fichier->nombres != NULL && fichier->copies) {
+        for (size_t i = 0; i < fichier->nb; ++i) {
+            if (fichier->nombres[i].Tdigits != NULL) libereBigBinary(&fichier->nombres[i]);
+        }
+    }
+    if (fichier->nombres != NULL) {
+        liberation(fichier->allocateur, fichier->nombres,
+                   sizeof(BigBinary) * (fichier->nb > 0 ? fichier->nb : 1), ALIGNEMENT_NATUREL);
+    }
+
+    if (fichier->base != NULL) {
+#if BIGBINARY_MMAP
+        if (fichier->projete) munmap(fichier->base, fichier->taille);
+#endif
+        if (!fichier->projete) {
+            liberation(fichier->allocateur, fichier->base, fichier->taille, BIGBINARY_ALIGNEMENT_LIMBES);
+        }
+    }
+    memset(fichier, 0, sizeof(*fichier));
+}
+
+// ============================================================================
+// ==================== PHASE 2: EXPONENTIATION MODULAIRE =====================
+// ============================================================================
+
+/**
+ * \brief Exponentiation modulaire (version avec exposant BigBinary)
+ * \param M Base
  * \param exp Exposant (BigBinary)
  * \param n Module
  * \return M^exp mod n
@@ -1082,16 +4894,44 @@ void libereDivisionResult(DivisionResult *res) {
     de manière cumulative avec modulo à chaque étape.
  */
 BigBinary ExpMod(BigBinary M, BigBinary exp, BigBinary n) {
+    // Copies partagées: M n'est dupliqué que si la réduction modulo n l'exige
+    return ExpMod_consomme(copieBigBinary(M), copieBigBinary(exp), n);
+}
+
+/**
+ * \brief Exponentiation modulaire qui prend possession de M et exp
+ * \param M Base (consommée: ne plus l'utiliser ni la libérer)
+ * \param exp Exposant (consommé)
+ * \param n Module (seulement lu)
+ * \return M^exp mod n
+ *
+ * La base est réduite directement dans le tableau de M. Pour un grand
+ * module impair (tailles RSA), l'exponentiation se fait en arithmétique
+ * de Montgomery sur les limbes (voir expModMontgomery).
+ */
+BigBinary ExpMod_consomme(BigBinary M, BigBinary exp, BigBinary n) {
     // Si l'exposant est 0, M^0 = 1
     if (estNul(exp)) {
+        libereBigBinary(&M);
+        libereBigBinary(&exp);
         BigBinary un = creerBigBinaryDepuisChaine("1");
         return un;
     }
 
+    // === GRAND MODULE IMPAIR: Montgomery sur les limbes ===
+    if (n.Signe > 0 && M.Signe >= 0 && n.Taille >= SEUIL_BITS_LIMBES &&
+        n.Tdigits[n.Taille - 1] == 1) {
+        BigBinary resultat = expModMontgomery(M, exp, n);
+        libereBigBinary(&M);
+        libereBigBinary(&exp);
+        return resultat;
+    }
+
     // Initialisations
     BigBinary resultat = creerBigBinaryDepuisChaine("1");
-    BigBinary base = Modulo(M, n);      // M réduit modulo n
-    BigBinary exposant = copieBigBinary(exp);
+    BigBinary base = Modulo_consomme(M, n);  // M réduit modulo n, en place
+    // Vue sur exp: la division par 2 revient à raccourcir la vue, sans copie
+    VueBigBinary exposant = vueValeurAbsolue(exp);
 
     // Boucle tant que l'exposant n'est pas nul
     while (!estNul(exposant)) {
@@ -1109,11 +4949,11 @@ BigBinary ExpMod(BigBinary M, BigBinary exp, BigBinary n) {
         base = temp;
 
         // Diviser l'exposant par 2 (décalage à droite)
-        divisePar2(&exposant);
+        exposant = vueBitsHauts(exposant, 1);
     }
 
     libereBigBinary(&base);
-    libereBigBinary(&exposant);
+    libereBigBinary(&exp);
     return resultat;
 }
 
@@ -1183,6 +5023,12 @@ BigBinary ExpModInt(BigBinary M, unsigned int exp, BigBinary n) {
     - On parcourt les bits de B du MSB au LSB
     - À chaque bit: résultat = résultat * 2 (mod n)
     - Si le bit de B est 1: résultat = résultat + base (mod n)
+
+    Pour les grands modules (tailles RSA), le produit complet est calculé
+    sur les limbes puis réduit par division (voir produitModLimbes).
+
+    Opérandes signés: le calcul porte sur |A| et |B|, le signe est appliqué
+    une seule fois à la fin (résultat toujours dans [0, n)).
  */
 BigBinary multiplicationMod(BigBinary A, BigBinary B, BigBinary n) {
     // Cas trivial: 0 * anything = 0
@@ -1190,32 +5036,481 @@ BigBinary multiplicationMod(BigBinary A, BigBinary B, BigBinary n) {
         return creerZero();
     }
 
+    // === GRANDS MODULES: produit et réduction sur les limbes ===
+    if (n.Signe > 0 && A.Signe > 0 && B.Signe > 0 && n.Taille >= SEUIL_BITS_LIMBES) {
+        return produitModLimbes(A, B, n);
+    }
+
     BigBinary resultat = creerZero();
-    BigBinary base = Modulo(A, n);  // Réduire A modulo n
+    BigBinary base = Modulo(A, n);  // Réduire A modulo n (signe de A)
+    base.Signe = 1;                 // |A| mod n: le calcul porte sur les grandeurs
 
-    // Parcourir chaque bit de B du MSB (index 0) au LSB
+    // Parcourir chaque bit de |B| du MSB (index 0) au LSB
     for (int i = 0; i < B.Taille; i++) {
         // === DOUBLER LE RÉSULTAT (shift left) ===
         // résultat = résultat * 2 mod n
-        BigBinary temp = multiplePar2(resultat);
-        libereBigBinary(&resultat);
-        resultat = Modulo(temp, n);
-        libereBigBinary(&temp);
+        decaleGaucheEnPlace(&resultat, 1);
+        resultat = Modulo_consomme(resultat, n);
 
         // === SI LE BIT EST 1: AJOUTER LA BASE ===
         if (B.Tdigits[i] == 1) {
             // résultat = résultat + base mod n
             BigBinary somme = Addition(resultat, base);
             libereBigBinary(&resultat);
-            resultat = Modulo(somme, n);
-            libereBigBinary(&somme);
+            resultat = Modulo_consomme(somme, n);
         }
     }
 
+    // === SIGNE: A * B < 0 donne n - (|A| * |B| mod n) ===
+    if (A.Signe * B.Signe < 0 && !estNul(resultat)) {
+        BigBinary oppose = Soustraction(n, resultat);
+        libereBigBinary(&resultat);
+        resultat = oppose;
+    }
+
     libereBigBinary(&base);
     return resultat;
 }
 
+// ============================================================================
+// ========= AJOUT: EXPONENTIATION MODULAIRE PAR LOTS (MONTGOMERY) ============
+// ============================================================================
+
+/*
+ * Quand beaucoup d'exponentiations indépendantes partagent le même module
+ * (chiffrement RSA d'un tableau de messages), on en traite
+ * BIGBINARY_LARGEUR_LOT à la fois, une par voie d'un registre AVX2.
+ *
+ * === Représentation ===
+ * - Limbes de 26 bits stockés dans des mots de 64 bits: un produit de deux
+ *   limbes tient sur 52 bits, et des centaines de produits s'accumulent
+ *   sans propager de retenue (_mm256_mul_epu32 multiplie 32 x 32 -> 64)
+ * - Les 4 voies sont entrelacées: case [4 * i + voie] = limbe i de la voie
+ * - Le module est le même pour toutes les voies (répliqué 4 fois)
+ *
+ * === Montgomery ===
+ * R = 2^(26k) avec R >= 4n: pour a, b < 2n, a * b / R mod n reste < 2n,
+ * aucune soustraction conditionnelle n'est nécessaire entre deux produits.
+ * La réduction finale est faite une seule fois, à la sortie du domaine
+ * de Montgomery.
+ *
+ * Sans AVX2 (ou hors x86), le même algorithme tourne en C portable sur
+ * les 4 voies: les résultats sont identiques. Le noyau est choisi au
+ * chargement (voir choisirExtensions).
+ */
+
+#define BITS_LIMBE_LOT 26
+#define MASQUE_LIMBE_LOT ((UINT64_C(1) << BITS_LIMBE_LOT) - 1)
+
+// Nombre maximal de limbes de 26 bits: au-delà, les accumulations sans
+// retenue pourraient dépasser 64 bits (k * 2^53 < 2^63)
+#define LIMBES_LOT_MAX 512
+
+// Module et précalculs partagés par toutes les voies
+typedef struct {
+    int k;                   // Nombre de limbes de 26 bits
+    uint64_t nInverse;       // -n^-1 mod 2^26
+    uint64_t *n4;            // Module en limbes de 26 bits, répliqué sur les voies
+    uint64_t *nLimbes;       // Module en limbes de 64 bits (conversions)
+    int nl;
+    uint64_t *t;             // Accumulateur de 2k limbes par voie
+    NoyauMontgomeryLot noyau;
+} ContexteLot;
+
+/**
+ * \brief Produit de Montgomery sur 4 voies, version C portable
+ * \param r Résultat a * b / R mod n (< 2n), peut être confondu avec a ou b
+ * \param a, b Opérandes entrelacés (< 2n, limbes normalisés sur 26 bits)
+ * \param n4 Module entrelacé
+ * \param nInverse -n^-1 mod 2^26
+ * \param k Nombre de limbes
+ * \param t Tampon de 2k * 4 mots
+ *
+ * L'accumulateur avance d'un limbe par tour au lieu d'être décalé: au
+ * tour i, les limbes utiles sont t[i..i+k). Les retenues ne sont
+ * propagées qu'à la fin.
+ */
+static void montgomeryLot4Portable(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                   const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t) {
+    const int L = BIGBINARY_LARGEUR_LOT;
+    memset(t, 0, sizeof(uint64_t) * 2 * k * L);
+
+    for (int i = 0; i < k; ++i) {
+        uint64_t *ti = t + L * i;
+        const uint64_t *ai = a + L * i;
+        uint64_t m[BIGBINARY_LARGEUR_LOT];
+
+        // Limbe de poids faible: choisir m pour l'annuler, puis l'éliminer
+        for (int v = 0; v < L; ++v) {
+            uint64_t t0 = ti[v] + ai[v] * b[v];
+            m[v] = ((t0 & MASQUE_LIMBE_LOT) * nInverse) & MASQUE_LIMBE_LOT;
+            ti[L + v] += (t0 + m[v] * n4[v]) >> BITS_LIMBE_LOT;
+        }
+        for (int j = 1; j < k; ++j) {
+            for (int v = 0; v < L; ++v) {
+                ti[L * j + v] += ai[v] * b[L * j + v] + m[v] * n4[L * j + v];
+            }
+        }
+    }
+
+    // Propagation des retenues: résultat dans t[k..2k)
+    uint64_t retenue[BIGBINARY_LARGEUR_LOT] = {0};
+    for (int j = 0; j < k; ++j) {
+        for (int v = 0; v < L; ++v) {
+            uint64_t x = t[L * (k + j) + v] + retenue[v];
+            r[L * j + v] = x & MASQUE_LIMBE_LOT;
+            retenue[v] = x >> BITS_LIMBE_LOT;
+        }
+    }
+}
+
+#if BIGBINARY_X86
+/**
+ * \brief Produit de Montgomery sur 4 voies, version AVX2
+ *
+ * Même calcul que montgomeryLot4Portable, une voie par mot de 64 bits
+ * d'un registre de 256 bits.
+ */
+__attribute__((target("avx2")))
+static void montgomeryLot4Avx2(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                               const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t) {
+    __m256i *T = (__m256i *)t;
+    const __m256i *A = (const __m256i *)a;
+    const __m256i *B = (const __m256i *)b;
+    const __m256i *N = (const __m256i *)n4;
+    const __m256i masque = _mm256_set1_epi64x((long long)MASQUE_LIMBE_LOT);
+    const __m256i inverse = _mm256_set1_epi64x((long long)nInverse);
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (int i = 0; i < 2 * k; ++i) _mm256_store_si256(T + i, zero);
+
+    for (int i = 0; i < k; ++i) {
+        __m256i ai = _mm256_load_si256(A + i);
+        __m256i t0 = _mm256_add_epi64(_mm256_load_si256(T + i), _mm256_mul_epu32(ai, B[0]));
+        __m256i m = _mm256_and_si256(_mm256_mul_epu32(_mm256_and_si256(t0, masque), inverse), masque);
+        t0 = _mm256_add_epi64(t0, _mm256_mul_epu32(m, N[0]));
+        T[i + 1] = _mm256_add_epi64(T[i + 1], _mm256_srli_epi64(t0, BITS_LIMBE_LOT));
+
+        for (int j = 1; j < k; ++j) {
+            __m256i p = _mm256_add_epi64(_mm256_mul_epu32(ai, B[j]), _mm256_mul_epu32(m, N[j]));
+            T[i + j] = _mm256_add_epi64(T[i + j], p);
+        }
+    }
+
+    __m256i retenue = zero;
+    for (int j = 0; j < k; ++j) {
+        __m256i x = _mm256_add_epi64(T[k + j], retenue);
+        _mm256_store_si256((__m256i *)r + j, _mm256_and_si256(x, masque));
+        retenue = _mm256_srli_epi64(x, BITS_LIMBE_LOT);
+    }
+}
+
+/**
+ * \brief Produit de Montgomery sur 4 voies, version AVX-512
+ *
+ * Même disposition que la version AVX2: deux limbes consécutifs des 4
+ * voies forment un registre de 512 bits, la boucle interne traite donc
+ * deux limbes par instruction.
+ */
+__attribute__((target("avx512f")))
+static void montgomeryLot4Avx512(uint64_t *r, const uint64_t *a, const uint64_t *b,
+                                 const uint64_t *n4, uint64_t nInverse, int k, uint64_t *t) {
+    __m256i *T = (__m256i *)t;
+    const __m256i *A = (const __m256i *)a;
+    const __m256i *B = (const __m256i *)b;
+    const __m256i *N = (const __m256i *)n4;
+    const __m256i masque = _mm256_set1_epi64x((long long)MASQUE_LIMBE_LOT);
+    const __m256i inverse = _mm256_set1_epi64x((long long)nInverse);
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (int i = 0; i < 2 * k; ++i) _mm256_store_si256(T + i, zero);
+
+    for (int i = 0; i < k; ++i) {
+        __m256i ai = _mm256_load_si256(A + i);
+        __m256i t0 = _mm256_add_epi64(_mm256_load_si256(T + i), _mm256_mul_epu32(ai, B[0]));
+        __m256i m = _mm256_and_si256(_mm256_mul_epu32(_mm256_and_si256(t0, masque), inverse), masque);
+        t0 = _mm256_add_epi64(t0, _mm256_mul_epu32(m, N[0]));
+        T[i + 1] = _mm256_add_epi64(T[i + 1], _mm256_srli_epi64(t0, BITS_LIMBE_LOT));
+
+        __m512i ai2 = _mm512_broadcast_i64x4(ai);
+        __m512i m2 = _mm512_broadcast_i64x4(m);
+        int j = 1;
+        for (; j + 1 < k; j += 2) {
+            __m512i p = _mm512_add_epi64(_mm512_mul_epu32(ai2, _mm512_loadu_si512(B + j)),
+                                         _mm512_mul_epu32(m2, _mm512_loadu_si512(N + j)));
+            _mm512_storeu_si512(T + i + j, _mm512_add_epi64(_mm512_loadu_si512(T + i + j), p));
+        }
+        if (j < k) {
+            __m256i p = _mm256_add_epi64(_mm256_mul_epu32(ai, B[j]), _mm256_mul_epu32(m, N[j]));
+            T[i + j] = _mm256_add_epi64(T[i + j], p);
+        }
+    }
+
+    __m256i retenue = zero;
+    for (int j = 0; j < k; ++j) {
+        __m256i x = _mm256_add_epi64(T[k + j], retenue);
+        _mm256_store_si256((__m256i *)r + j, _mm256_and_si256(x, masque));
+        retenue = _mm256_srli_epi64(x, BITS_LIMBE_LOT);
+    }
+}
+#endif
+
+/**
+ * \brief Indique si les fonctions par lots utilisent les instructions SIMD
+ * \return true si le noyau lié est la version AVX2 ou AVX-512
+ */
+bool lotMontgomeryVectorise(void) {
+    return noyaux.montgomeryLot != montgomeryLot4Portable;
+}
+
+/**
+ * \brief Découpe des limbes de 64 bits en limbes de 26 bits, dans une voie
+ */
+static void eclateLimbesLot(uint64_t *dest, int voie, const uint64_t *src, int ns, int k) {
+    for (int i = 0; i < k; ++i) {
+        int o = BITS_LIMBE_LOT * i, w = o >> 6, s = o & 63;
+        uint64_t v = (w < ns) ? src[w] >> s : 0;
+        if (s > 64 - BITS_LIMBE_LOT && w + 1 < ns) v |= src[w + 1] << (64 - s);
+        dest[BIGBINARY_LARGEUR_LOT * i + voie] = v & MASQUE_LIMBE_LOT;
+    }
+}
+
+/**
+ * \brief Regroupe une voie de limbes de 26 bits en limbes de 64 bits
+ */
+static void regroupeLimbesLot(uint64_t *dest, int nd, const uint64_t *src, int voie, int k) {
+    memset(dest, 0, sizeof(uint64_t) * nd);
+    for (int i = 0; i < k; ++i) {
+        int o = BITS_LIMBE_LOT * i, w = o >> 6, s = o & 63;
+        uint64_t v = src[BIGBINARY_LARGEUR_LOT * i + voie];
+        dest[w] |= v << s;
+        if (s > 64 - BITS_LIMBE_LOT && w + 1 < nd) dest[w + 1] |= v >> (64 - s);
+    }
+}
+
+/**
+ * \brief Prépare le module pour les lots
+ * \return false si n ne convient pas (pair, <= 1, ou trop grand)
+ */
+static bool preparerContexteLot(ContexteLot *ctx, BigBinary n) {
+    if (n.Signe <= 0 || n.Taille < 2 || n.Tdigits[n.Taille - 1] == 0) return false;
+
+    int k = (n.Taille + 2 + BITS_LIMBE_LOT - 1) / BITS_LIMBE_LOT;
+    if (k > LIMBES_LOT_MAX) return false;
+
+    ctx->k = k;
+    ctx->nLimbes = versLimbes(n, &ctx->nl);
+
+    // Inverse de n modulo 2^64 par Newton (n impair), puis -n^-1 mod 2^26
+    uint64_t n0 = ctx->nLimbes[0], x = n0;
+    for (int i = 0; i < 5; ++i) x *= 2 - n0 * x;
+    ctx->nInverse = (0 - x) & MASQUE_LIMBE_LOT;
+
+    ctx->n4 = alloueLimbes((size_t)BIGBINARY_LARGEUR_LOT * k);
+    for (int v = 0; v < BIGBINARY_LARGEUR_LOT; ++v) {
+        eclateLimbesLot(ctx->n4, v, ctx->nLimbes, ctx->nl, k);
+    }
+    ctx->t = alloueLimbes((size_t)2 * BIGBINARY_LARGEUR_LOT * k);
+    ctx->noyau = noyaux.montgomeryLot;
+    return true;
+}
+
+static void libererContexteLot(ContexteLot *ctx) {
+    libereLimbes(ctx->nLimbes, ctx->nl);
+    libereLimbes(ctx->n4, (size_t)BIGBINARY_LARGEUR_LOT * ctx->k);
+    libereLimbes(ctx->t, (size_t)2 * BIGBINARY_LARGEUR_LOT * ctx->k);
+}
+
+/**
+ * \brief Place |x| * 2^decalage mod n dans une voie
+ *
+ * decalage = 26k donne la forme de Montgomery x * R mod n, decalage = 0
+ * une simple réduction modulo n.
+ */
+static void placerDansVoie(uint64_t *dest, int voie, BigBinary x, const ContexteLot *ctx, int decalage) {
+    int nx;
+    uint64_t *xl = versLimbes(x, &nx);
+    int mots = decalage / 64, bits = decalage % 64;
+    int nu = nx + mots + 1;
+    uint64_t *u = alloueLimbesZero(nu);
+    for (int i = 0; i < nx; ++i) {
+        u[i + mots] |= xl[i] << bits;
+        if (bits) u[i + mots + 1] |= xl[i] >> (64 - bits);
+    }
+
+    uint64_t *reste = alloueLimbes(ctx->nl);
+    divLimbes(NULL, reste, u, nu, ctx->nLimbes, ctx->nl);
+    eclateLimbesLot(dest, voie, reste, ctx->nl, ctx->k);
+
+    libereLimbes(reste, ctx->nl);
+    libereLimbes(u, nu);
+    libereLimbes(xl, nx);
+}
+
+/**
+ * \brief Sort une voie du domaine de Montgomery et la réduit modulo n
+ * \param acc Valeurs entrelacées (déjà multipliées par R^-1)
+ */
+static BigBinary extraireVoie(const uint64_t *acc, int voie, const ContexteLot *ctx, BigBinary n) {
+    int nd = (BITS_LIMBE_LOT * ctx->k + 63) / 64;
+    uint64_t *limbes = alloueLimbes(nd);
+    regroupeLimbesLot(limbes, nd, acc, voie, ctx->k);
+    BigBinary r = depuisLimbes(limbes, nd, 1);
+    libereLimbes(limbes, nd);
+    return Modulo_consomme(r, n);  // au plus une soustraction
+}
+
+/**
+ * \brief Exponentiation d'un groupe de nbVoies bases (<= BIGBINARY_LARGEUR_LOT)
+ *
+ * Fenêtre fixe de 4 bits, de gauche à droite: 4 carrés puis un produit
+ * par la puissance choisie dans la table de chaque voie. Les voies dont
+ * l'exposant est plus court lisent des chiffres nuls (produit par 1).
+ */
+static void expModGroupe(const ContexteLot *ctx, const BigBinary *bases, const BigBinary *exposants,
+                         BigBinary *resultats, int nbVoies, BigBinary n) {
+    const int L = BIGBINARY_LARGEUR_LOT;
+    const int k = ctx->k;
+    const size_t taille = (size_t)L * k;
+    const int nbPuissances = 1 << FENETRE_EXPOSANT;
+
+    uint64_t *table = alloueLimbesZero(taille * nbPuissances);
+    uint64_t *acc = alloueLimbes(taille);
+    uint64_t *operande = alloueLimbes(taille);
+
+    // table[0] = 1 (forme de Montgomery: R mod n), table[1] = base * R mod n
+    BigBinary un = creerBigBinaryDepuisDecimal(1);
+    bool actif[BIGBINARY_LARGEUR_LOT];
+    int bitsMax = 0;
+    for (int v = 0; v < L; ++v) {
+        // Bases négatives: même résultat que ExpMod, calculé à part
+        actif[v] = (v < nbVoies && bases[v].Signe >= 0);
+        placerDansVoie(table, v, un, ctx, BITS_LIMBE_LOT * k);
+        if (actif[v]) {
+            placerDansVoie(table + taille, v, bases[v], ctx, BITS_LIMBE_LOT * k);
+            int bits = (exposants[v].Signe == 0) ? 0 : exposants[v].Taille;
+            if (bits > bitsMax) bitsMax = bits;
+        }
+    }
+    libereBigBinary(&un);
+
+    for (int j = 2; j < nbPuissances; ++j) {
+        ctx->noyau(table + taille * j, table + taille * (j - 1), table + taille, ctx->n4,
+                   ctx->nInverse, k, ctx->t);
+    }
+
+    int nbFenetres = (bitsMax + FENETRE_EXPOSANT - 1) / FENETRE_EXPOSANT;
+    if (nbFenetres == 0) nbFenetres = 1;
+
+    for (int f = nbFenetres - 1; f >= 0; --f) {
+        // Opérande: puissance choisie par le chiffre de chaque voie
+        for (int v = 0; v < L; ++v) {
+            int chiffre = actif[v] ? chiffreExposant(exposants[v], f) : 0;
+            const uint64_t *source = table + taille * chiffre;
+            for (int i = 0; i < k; ++i) operande[L * i + v] = source[L * i + v];
+        }
+
+        if (f == nbFenetres - 1) {
+            memcpy(acc, operande, sizeof(uint64_t) * taille);
+            continue;
+        }
+        for (int c = 0; c < FENETRE_EXPOSANT; ++c) {
+            ctx->noyau(acc, acc, acc, ctx->n4, ctx->nInverse, k, ctx->t);
+        }
+        ctx->noyau(acc, acc, operande, ctx->n4, ctx->nInverse, k, ctx->t);
+    }
+
+    // Sortie du domaine de Montgomery: produit par 1
+    memset(operande, 0, sizeof(uint64_t) * taille);
+    for (int v = 0; v < L; ++v) operande[v] = 1;
+    ctx->noyau(acc, acc, operande, ctx->n4, ctx->nInverse, k, ctx->t);
+
+    for (int v = 0; v < nbVoies; ++v) {
+        resultats[v] = actif[v] ? extraireVoie(acc, v, ctx, n)
+                                : ExpMod(bases[v], exposants[v], n);
+    }
+
+    libereLimbes(operande, taille);
+    libereLimbes(acc, taille);
+    libereLimbes(table, taille * nbPuissances);
+}
+
+/**
+ * \brief Exponentiation modulaire d'un lot de bases avec le même module
+ * \param bases Bases M[i]
+ * \param exposants Exposants e[i] (un par base)
+ * \param resultats Reçoit M[i]^e[i] mod n, dans le même ordre (à libérer)
+ * \param nb Nombre d'exponentiations
+ * \param n Module commun
+ *
+ * Les exponentiations sont faites par groupes de BIGBINARY_LARGEUR_LOT
+ * en arithmétique de Montgomery, en SIMD si le processeur a l'AVX2.
+ * Les résultats sont ceux d'ExpMod; si n ne se prête pas à Montgomery
+ * (pair, ou plus de 13 000 bits), chaque élément passe par ExpMod.
+ */
+void ExpModLot(const BigBinary *bases, const BigBinary *exposants, BigBinary *resultats, int nb,
+               BigBinary n) {
+    ContexteLot ctx;
+    if (!preparerContexteLot(&ctx, n)) {
+        for (int i = 0; i < nb; ++i) resultats[i] = ExpMod(bases[i], exposants[i], n);
+        return;
+    }
+
+    for (int debut = 0; debut < nb; debut += BIGBINARY_LARGEUR_LOT) {
+        int nbVoies = nb - debut < BIGBINARY_LARGEUR_LOT ? nb - debut : BIGBINARY_LARGEUR_LOT;
+        expModGroupe(&ctx, bases + debut, exposants + debut, resultats + debut, nbVoies, n);
+    }
+    libererContexteLot(&ctx);
+}
+
+/**
+ * \brief Multiplication modulaire d'un lot de paires avec le même module
+ * \param A, B Opérandes (A[i], B[i])
+ * \param resultats Reçoit (A[i] * B[i]) mod n, dans le même ordre (à libérer)
+ * \param nb Nombre de produits
+ * \param n Module commun
+ *
+ * Un seul produit de Montgomery par groupe: (A R mod n) * B / R = A B mod n.
+ * Mêmes résultats que multiplicationMod.
+ */
+void multiplicationModLot(const BigBinary *A, const BigBinary *B, BigBinary *resultats, int nb,
+                          BigBinary n) {
+    ContexteLot ctx;
+    if (!preparerContexteLot(&ctx, n)) {
+        for (int i = 0; i < nb; ++i) resultats[i] = multiplicationMod(A[i], B[i], n);
+        return;
+    }
+
+    const int L = BIGBINARY_LARGEUR_LOT;
+    const size_t taille = (size_t)L * ctx.k;
+    uint64_t *a = alloueLimbes(taille);
+    uint64_t *b = alloueLimbes(taille);
+
+    for (int debut = 0; debut < nb; debut += L) {
+        bool actif[BIGBINARY_LARGEUR_LOT];
+        memset(a, 0, sizeof(uint64_t) * taille);
+        memset(b, 0, sizeof(uint64_t) * taille);
+        for (int v = 0; v < L && debut + v < nb; ++v) {
+            actif[v] = (A[debut + v].Signe >= 0 && B[debut + v].Signe >= 0);
+            if (actif[v]) {
+                placerDansVoie(a, v, A[debut + v], &ctx, BITS_LIMBE_LOT * ctx.k);
+                placerDansVoie(b, v, B[debut + v], &ctx, 0);
+            }
+        }
+
+        ctx.noyau(a, a, b, ctx.n4, ctx.nInverse, ctx.k, ctx.t);
+
+        for (int v = 0; v < L && debut + v < nb; ++v) {
+            resultats[debut + v] = actif[v] ? extraireVoie(a, v, &ctx, n)
+                                            : multiplicationMod(A[debut + v], B[debut + v], n);
+        }
+    }
+
+    libereLimbes(a, taille);
+    libereLimbes(b, taille);
+    libererContexteLot(&ctx);
+}
+
 // ============================================================================
 // =========================== PHASE 3: RSA (BONUS) ===========================
 // ============================================================================
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #define BASE 2  // La base du nombre (2 pour binaire)
 
@@ -13,8 +14,87 @@ typedef struct {
     int *Tdigits;  // Tableau de bits : Tdigits[0] = bit de poids fort (MSB), Tdigits[Taille - 1] = bit de poids faible (LSB)
     int Taille;    // Nombre de bits significatifs
     int Signe;     // +1 pour positif, -1 pour négatif, 0 pour nul
+    size_t *Partage; // Compteur de références du tableau (copie sur écriture), NULL pour une vue
 } BigBinary;
 
+// ========== AJOUT: ALLOCATEUR PERSONNALISABLE ==========
+
+// Alignement garanti des tableaux de limbes internes (ligne de cache)
+#define BIGBINARY_ALIGNEMENT_LIMBES 64
+
+// Fonctions d'allocation utilisées pour toute la mémoire interne de la bibliothèque.
+// Les tailles et l'alignement (puissance de 2) sont passés à chaque appel, ce qui
+// permet de compter ou de plafonner la mémoire. reallouer peut être NULL.
+// Un refus (NULL) de allouer ou reallouer est fatal: message sur stderr puis abort()
+// (seul ouvrirFichierBigBinary rend alors false); un plafond arrête donc le programme.
+typedef struct {
+    void *(*allouer)(size_t taille, size_t alignement, void *contexte);
+    void *(*reallouer)(void *ptr, size_t ancienneTaille, size_t nouvelleTaille, size_t alignement, void *contexte);
+    void (*liberer)(void *ptr, size_t taille, size_t alignement, void *contexte);
+    void *contexte;
+} AllocateurBigBinary;
+
+// Installe l'allocateur global (NULL = malloc/free)
+void definirAllocateur(const AllocateurBigBinary *allocateur);
+
+// Installe un allocateur pour le thread courant (NULL = global); false si non supporté
+bool definirAllocateurThread(const AllocateurBigBinary *allocateur);
+
+// Allocateur utilisé par le thread courant
+const AllocateurBigBinary *allocateurCourant(void);
+
+// Allocateur installé pour le thread courant seulement (NULL si aucun), à sauvegarder avant d'en changer
+const AllocateurBigBinary *allocateurThreadCourant(void);
+
+// Allocateur global effectif (malloc/free si aucun n'est installé)
+const AllocateurBigBinary *allocateurGlobalCourant(void);
+
+// ========== AJOUT: EXÉCUTEUR DE SOUS-CALCULS (PARALLÉLISME INTERNE) ==========
+// Les très grandes multiplications découpent leur travail en sous-produits
+// indépendants et les confient à l'exécuteur du thread s'il y en a un
+// (voir executeurPool dans parallele.h), sinon les calculent en séquence.
+
+// Sous-calcul numéro indice d'un groupe
+typedef void (*SousTache)(int indice, void *contexteTache);
+
+// executer() lance tache(0..nb-1), éventuellement en parallèle, et rend la main
+// quand toutes sont terminées. Elle doit accepter d'être rappelée depuis une sous-tâche.
+typedef struct {
+    void (*executer)(int nb, SousTache tache, void *contexteTache, void *contexte);
+    void *contexte;
+} ExecuteurBigBinary;
+
+// Installe un exécuteur pour le thread courant (NULL = séquentiel); false si non supporté
+bool definirExecuteurThread(const ExecuteurBigBinary *executeur);
+
+// Exécuteur du thread courant (NULL si séquentiel)
+const ExecuteurBigBinary *executeurCourant(void);
+
+// ========== AJOUT: CHOIX DES NOYAUX DE CALCUL SELON LE PROCESSEUR ==========
+// Les extensions x86-64 sont détectées au chargement et chaque opération
+// interne utilise la meilleure variante disponible. La variable
+// d'environnement BIGBINARY_EXTENSIONS ("aucune", "bmi2,avx2"...) ou
+// choisirExtensions() restreignent ce choix (tests, mesures).
+
+#define BIGBINARY_EXT_BMI2   0x1u  // MULX
+#define BIGBINARY_EXT_ADX    0x2u  // ADCX / ADOX
+#define BIGBINARY_EXT_AVX2   0x4u
+#define BIGBINARY_EXT_AVX512 0x8u  // AVX-512F
+#define BIGBINARY_EXT_TOUTES 0xFu
+
+// Extensions présentes sur le processeur courant
+unsigned int extensionsDetectees(void);
+
+// Autorise seulement les extensions du masque (0 = C portable); renvoie celles utilisées
+// (à appeler avant de lancer des calculs dans d'autres threads)
+unsigned int choisirExtensions(unsigned int autorisees);
+
+// Extensions utilisées par les noyaux actuellement choisis
+unsigned int extensionsActives(void);
+
+// Affiche les extensions détectées et les variantes utilisées
+void afficheNoyaux(void);
+
 // ========== FONCTIONS D'INITIALISATION ET MANIPULATION DE BASE ==========
 
 // Initialisation manuelle d'un BigBinary vide (tout est à zéro)
@@ -26,29 +106,68 @@ BigBinary creerBigBinaryDepuisChaine(const char *chaine);
 // Création d'un BigBinary depuis un entier décimal (long long)
 BigBinary creerBigBinaryDepuisDecimal(long long nombre);
 
+// Création d'un BigBinary depuis une chaîne décimale de taille quelconque ("-123...")
+BigBinary creerBigBinaryDepuisChaineDecimale(const char *chaine);
+
+// Création d'un BigBinary depuis une chaîne hexadécimale ("-0x1f...")
+BigBinary creerBigBinaryDepuisHexa(const char *chaine);
+
+// Création d'un BigBinary positif depuis des octets bruts (big- ou little-endian)
+BigBinary creerBigBinaryDepuisOctets(const uint8_t *octets, size_t n, bool grosBoutiste);
+
 // Création d'un BigBinary représentant zéro
 BigBinary creerZero();
 
 // Affichage du nombre binaire
 void afficheBigBinary(BigBinary nb);
 
+// Conversion en chaîne binaire (à libérer avec free)
+char *BigBinaryVersChaine(BigBinary nb);
+
+// Affichage du nombre en décimal
+void afficheBigBinaryDecimal(BigBinary nb);
+
+// Conversion en chaîne décimale (à libérer avec free)
+char *BigBinaryVersChaineDecimale(BigBinary nb);
+
+// Conversion en chaîne hexadécimale (à libérer avec free)
+char *BigBinaryVersHexa(BigBinary nb);
+
+// Nombre d'octets nécessaires pour la magnitude
+size_t nombreOctets(BigBinary nb);
+
+// Export de la magnitude en octets bruts, complétée à 'taille' octets (0 si trop petit)
+size_t BigBinaryVersOctets(BigBinary nb, uint8_t *dest, size_t taille, bool grosBoutiste);
+
 // Libération de la mémoire
 void libereBigBinary(BigBinary *nb);
 
-// Copie d'un BigBinary
+// Copie d'un BigBinary (tableau partagé jusqu'à la première modification)
 BigBinary copieBigBinary(BigBinary nb);
 
+// Rend le tableau de nb modifiable (le copie s'il est partagé ou si nb est une vue)
+void rendreUnique(BigBinary *nb);
+
+// Déplacement : renvoie le contenu de source et laisse source vide (sans copie)
+BigBinary deplacer(BigBinary *source);
+
 // Calcul du nombre de bits significatifs (supprime les zéros de tête)
 void normaliser(BigBinary *nb);
 
 // ========== PHASE 1: OPÉRATIONS DE BASE ==========
 
-// Addition de deux BigBinary positifs : A + B
+// Addition signée de deux BigBinary : A + B (tous les signes)
 BigBinary Addition(BigBinary A, BigBinary B);
 
-// Soustraction de deux BigBinary positifs avec A >= B : A - B
+// Soustraction signée de deux BigBinary : A - B (négatif si A < B)
 BigBinary Soustraction(BigBinary A, BigBinary B);
 
+// Comparaison trois-voies : -1 si A < B, 0 si A == B, +1 si A > B
+int Comparer(BigBinary A, BigBinary B);
+
+// Comparaison trois-voies des valeurs absolues |A| et |B|
+int ComparerMagnitude(BigBinary A, BigBinary B);
+
 // Comparaison : renvoie true si A == B
 bool Egal(BigBinary A, BigBinary B);
 
@@ -66,13 +185,80 @@ void divisePar2(BigBinary *nb);
 // Multiplication par 2 (décalage à gauche)
 BigBinary multiplePar2(BigBinary nb);
 
+// Décalage à droite de k bits (division par 2^k), en place
+void decaleDroiteEnPlace(BigBinary *nb, int k);
+
+// Décalage à droite de k bits (division par 2^k), renvoie un nouveau BigBinary
+BigBinary decaleDroite(BigBinary nb, int k);
+
+// Décalage à gauche de k bits (multiplication par 2^k), en place
+void decaleGaucheEnPlace(BigBinary *nb, int k);
+
+// Décalage à gauche de k bits (multiplication par 2^k), renvoie un nouveau BigBinary
+BigBinary decaleGauche(BigBinary nb, int k);
+
 // Teste si un BigBinary est pair
 bool estPair(BigBinary nb);
 
 // Teste si un BigBinary est nul
 bool estNul(BigBinary nb);
 
-// Multiplication Égyptienne : A * B
+// ========== AJOUT: OPÉRATIONS BIT À BIT (sur les magnitudes) ==========
+
+// ET logique bit à bit : A & B
+BigBinary EtBinaire(BigBinary A, BigBinary B);
+
+// OU logique bit à bit : A | B
+BigBinary OuBinaire(BigBinary A, BigBinary B);
+
+// OU exclusif bit à bit : A ^ B
+BigBinary OuExclusif(BigBinary A, BigBinary B);
+
+// ET-NON bit à bit : A & ~B
+BigBinary EtNonBinaire(BigBinary A, BigBinary B);
+
+// NON bit à bit sur les Taille bits significatifs de A
+BigBinary NonBinaire(BigBinary A);
+
+// Teste le bit de rang i (rang 0 = LSB)
+bool testeBit(BigBinary nb, int i);
+
+// Met à 1 le bit de rang i (rang 0 = LSB), agrandit le nombre si besoin
+void metBit(BigBinary *nb, int i);
+
+// Met à 0 le bit de rang i (rang 0 = LSB)
+void effaceBit(BigBinary *nb, int i);
+
+// Nombre de bits à 1 (poids de Hamming)
+int poidsHamming(BigBinary nb);
+
+// Nombre de bits significatifs (0 pour le nombre nul)
+int longueurBits(BigBinary nb);
+
+// Nombre de zéros de poids faible (plus grand k tel que 2^k divise nb)
+int compteZerosFinaux(BigBinary nb);
+
+// ========== AJOUT: VUES EN LECTURE SEULE (SANS COPIE) ==========
+
+// Vue: BigBinary qui ne possède pas son tableau (ne jamais libérer ni modifier en place).
+// Acceptée partout où un BigBinary est passé par valeur (Egal, Addition, Multiplication...).
+typedef BigBinary VueBigBinary;
+
+// Vue normalisée sur des cases existantes (bits MSB en premier)
+VueBigBinary vueBigBinary(const int *cases, int taille, int signe);
+
+// Vue sur les bits de poids fort : |nb| / 2^k avec le signe de nb (préfixe du tableau)
+VueBigBinary vueBitsHauts(BigBinary nb, int k);
+
+// Vue sur les bits de poids faible : |nb| mod 2^k avec le signe de nb (suffixe du tableau)
+VueBigBinary vueBitsBas(BigBinary nb, int k);
+
+// Vue sur la valeur absolue : |nb|
+VueBigBinary vueValeurAbsolue(BigBinary nb);
+
+// ========== PHASE 2 (suite) ==========
+
+// Multiplication Égyptienne : A * B (règle des signes appliquée)
 BigBinary MultiplicationEgyptienne(BigBinary A, BigBinary B);
 
 // Calcul du PGCD par l'algorithme binaire d'Euclide
@@ -93,6 +279,69 @@ DivisionResult DivisionEuclidienne(BigBinary A, BigBinary B);
 // Libération de la mémoire d'un DivisionResult
 void libereDivisionResult(DivisionResult *res);
 
+// ========== AJOUT: OPÉRATIONS AVEC UN ENTIER NATIF (64 bits) ==========
+
+// Addition d'un entier natif : A + u
+BigBinary Addition_ui(BigBinary A, uint64_t u);
+
+// Soustraction d'un entier natif : A - u
+BigBinary Soustraction_ui(BigBinary A, uint64_t u);
+
+// Multiplication par un entier natif : A * u
+BigBinary Multiplication_ui(BigBinary A, uint64_t u);
+
+// Division par un entier natif : renvoie |A| / d (signe de A), *reste = |A| mod d
+BigBinary DivisionEuclidienne_ui(BigBinary A, uint64_t d, uint64_t *reste);
+
+// Reste de la division par un entier natif : |A| mod d
+uint64_t Modulo_ui(BigBinary A, uint64_t d);
+
+// ========== AJOUT: DIVISION PAR UN MOT AVEC INVERSE PRÉCALCULÉ ==========
+
+// Diviseur natif préparé pour des divisions répétées sans division matérielle
+typedef struct {
+    uint64_t d;          // Diviseur d'origine
+    uint64_t normalise;  // d << decalage (bit 63 à 1)
+    uint64_t inverse;    // floor((2^128 - 1) / normalise) - 2^64
+    int decalage;        // Nombre de zéros de tête de d
+} DiviseurNatif;
+
+// Précalcule l'inverse d'un diviseur natif non nul
+DiviseurNatif preparerDiviseurNatif(uint64_t d);
+
+// Division par un diviseur préparé : renvoie |A| / d (signe de A), *reste = |A| mod d
+BigBinary DivisionEuclidienne_pre(BigBinary A, const DiviseurNatif *dn, uint64_t *reste);
+
+// Reste de la division par un diviseur préparé : |A| mod d
+uint64_t Modulo_pre(BigBinary A, const DiviseurNatif *dn);
+
+// Restes de |A| modulo chaque diviseur de la table, en une seule passe sur A
+void ModuloMultiple_pre(BigBinary A, const DiviseurNatif *table, int nb, uint64_t *restes);
+
+// ========== AJOUT: FORMAT DE FICHIER BINAIRE ET CHARGEMENT PAR MMAP ==========
+
+// Table d'entiers chargée depuis un fichier binaire
+typedef struct {
+    BigBinary *nombres;  // Entiers du fichier (vues en lecture seule si copies == false)
+    size_t nb;           // Nombre d'entiers
+    void *base;          // Projection mémoire du fichier
+    size_t taille;       // Taille de la projection en octets
+    bool projete;        // true si base provient de mmap
+    bool copies;         // true si les entiers ont été convertis (à libérer)
+    const AllocateurBigBinary *allocateur;  // Allocateur de la table (et de base hors mmap)
+} FichierBigBinary;
+
+// Écrit une table d'entiers (compact = limbes 64 bits, sinon Tdigits brut projetable)
+bool ecrireFichierBigBinary(const char *chemin, const BigBinary *nombres, size_t nb, bool compact);
+
+// Ouvre un fichier binaire; les entiers pointent si possible directement dans la projection
+bool ouvrirFichierBigBinary(const char *chemin, FichierBigBinary *fichier);
+
+// Referme le fichier et libère les entiers convertis
+void fermerFichierBigBinary(FichierBigBinary *fichier);
+
+// ========== PHASE 2: EXPONENTIATION MODULAIRE ==========
+
 // Exponentiation modulaire : M^exp mod n
 // exp est passé comme BigBinary mais peut être simplifié en int si < 64 bits
 BigBinary ExpMod(BigBinary M, BigBinary exp, BigBinary n);
@@ -103,6 +352,41 @@ BigBinary ExpModInt(BigBinary M, unsigned int exp, BigBinary n);
 // Fonction auxiliaire pour la multiplication modulaire : (A * B) mod n
 BigBinary multiplicationMod(BigBinary A, BigBinary B, BigBinary n);
 
+// ========== AJOUT: VARIANTES QUI CONSOMMENT LEURS ARGUMENTS ==========
+// Les arguments marqués "consommé" appartiennent ensuite à la fonction:
+// leur tableau est réutilisé pour le résultat, l'appelant ne doit plus ni
+// les utiliser ni les libérer (voir deplacer()).
+
+// PGCD(A, B), A et B consommés
+BigBinary PGCD_consomme(BigBinary A, BigBinary B);
+
+// A mod B, A consommé
+BigBinary Modulo_consomme(BigBinary A, BigBinary B);
+
+// Division euclidienne de A par B, A consommé (le reste réutilise son tableau)
+DivisionResult DivisionEuclidienne_consomme(BigBinary A, BigBinary B);
+
+// M^exp mod n, M et exp consommés
+BigBinary ExpMod_consomme(BigBinary M, BigBinary exp, BigBinary n);
+
+// ========== AJOUT: EXPONENTIATION MODULAIRE PAR LOTS (MONTGOMERY) ==========
+// Plusieurs opérations indépendantes avec le même module, traitées par
+// groupes de BIGBINARY_LARGEUR_LOT voies (AVX2 si le processeur l'a).
+
+// Nombre d'opérations traitées ensemble
+#define BIGBINARY_LARGEUR_LOT 4
+
+// resultats[i] = bases[i]^exposants[i] mod n (mêmes résultats que ExpMod)
+void ExpModLot(const BigBinary *bases, const BigBinary *exposants, BigBinary *resultats, int nb,
+               BigBinary n);
+
+// resultats[i] = (A[i] * B[i]) mod n (mêmes résultats que multiplicationMod)
+void multiplicationModLot(const BigBinary *A, const BigBinary *B, BigBinary *resultats, int nb,
+                          BigBinary n);
+
+// true si les lots sont calculés avec les instructions AVX2
+bool lotMontgomeryVectorise(void);
+
 // ========== PHASE 3: RSA (BONUS) ==========
 
 // Chiffrement RSA : C = M^e mod N
@@ -1,29 +1,22 @@
 @echo off
 REM Script de compilation pour Windows
-REM Utilise gcc si disponible, sinon cl (Visual Studio)
+REM Necessite un gcc POSIX (MSYS2, Cygwin ou WSL): la bibliotheque utilise
+REM pthread, mmap, __thread et l'assembleur en ligne de GCC.
+REM Visual Studio (cl) et MinGW natif ne sont plus pris en charge.
 
 echo Compilation du projet BigBinary...
 
-REM Tenter avec gcc
 where gcc >nul 2>nul
 if %ERRORLEVEL% EQU 0 (
     echo Utilisation de GCC...
-    gcc -Wall -Wextra -std=c99 -g -c bigbinary.c -o bigbinary.o
-    gcc -Wall -Wextra -std=c99 -g -c main.c -o main.o
-    gcc -Wall -Wextra -std=c99 -g -o bigbinary.exe bigbinary.o main.o
-    echo Compilation terminee avec succes!
-    echo.
-    echo Pour executer le programme, tapez: bigbinary.exe
-    goto :end
-)
-
-REM Tenter avec cl (Visual Studio)
-where cl >nul 2>nul
-if %ERRORLEVEL% EQU 0 (
-    echo Utilisation de Microsoft C Compiler (cl)...
-    cl /W4 /c bigbinary.c
-    cl /W4 /c main.c
-    cl /Fe:bigbinary.exe bigbinary.obj main.obj
+    gcc -Wall -Wextra -std=c99 -g -pthread -c bigbinary.c -o bigbinary.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -c parallele.c -o parallele.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -c main.c -o main.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -c test_phase2.c -o test_phase2.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -c interactive.c -o interactive.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -o bigbinary.exe main.o bigbinary.o parallele.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -o test_phase2.exe test_phase2.o bigbinary.o parallele.o || goto :erreur
+    gcc -Wall -Wextra -std=c99 -g -pthread -o interactive.exe interactive.o bigbinary.o parallele.o || goto :erreur
     echo Compilation terminee avec succes!
     echo.
     echo Pour executer le programme, tapez: bigbinary.exe
@@ -34,12 +27,15 @@ echo.
 echo ERREUR: Aucun compilateur C trouve!
 echo.
 echo Veuillez installer l'un des suivants:
-echo   1. MinGW (pour gcc): https://www.mingw-w64.org/
-echo   2. Visual Studio Build Tools (pour cl)
-echo   3. WSL (Windows Subsystem for Linux)
+echo   1. MSYS2 ou Cygwin (pour gcc): https://www.msys2.org/
+echo   2. WSL (Windows Subsystem for Linux), puis utiliser make
 echo.
 goto :end
 
+:erreur
+echo.
+echo ERREUR: la compilation a echoue.
+echo Verifier que gcc est celui de MSYS2, Cygwin ou WSL (pas MinGW natif).
+
 :end
 pause
-
@@ -8,6 +8,7 @@
  * L'utilisateur peut choisir entre:
  * - Saisie binaire (format "1010")
  * - Saisie décimale (format "10")
+ * - Chargement depuis un fichier en tapant "@chemin" à la place du nombre
  *
  * Le menu est organisé par phases du projet ESIEA.
  */
@@ -17,8 +18,8 @@
 #include <string.h>
 #include <limits.h>
 
-// Taille du buffer pour lire les entrées utilisateur
-#define BUFFER_SIZE 2048
+// Taille initiale du tampon de lecture des opérandes (agrandi à la demande)
+#define TAILLE_LECTURE_INITIALE 4096
 
 /**
  * \brief Affiche le menu principal du mode interactif
@@ -34,7 +35,7 @@ void affiche_menu() {
     printf("╚════════════════════════════════════════════════════════════╝\n");
     printf("\nChoisissez une opération:\n");
     printf("  1. Addition (A + B)\n");
-    printf("  2. Soustraction (A - B, avec A >= B)\n");
+    printf("  2. Soustraction (A - B)\n");
     printf("  3. Multiplication Égyptienne (A × B)\n");
     printf("  4. PGCD (PGCD(A, B))\n");
     printf("  5. Modulo (A mod B)\n");
@@ -48,26 +49,136 @@ void affiche_menu() {
 }
 
 /**
- * \brief Lit une chaîne binaire au clavier
- * \param buffer Buffer où stocker la chaîne lue
- * \param taille Taille maximale du buffer
+ * \brief Agrandit un tampon de lecture pour qu'il puisse contenir au moins minimum octets
+ * \param tampon Adresse du tampon (réalloué sur place)
+ * \param capacite Adresse de la capacité courante (mise à jour)
+ * \param minimum Capacité minimale demandée
+ * \return true si l'agrandissement a réussi
+ *
+ * La capacité double à chaque fois: le coût total reste linéaire
+ * même pour des opérandes de plusieurs mégabits.
+ */
+static bool agrandir_tampon(char **tampon, size_t *capacite, size_t minimum) {
+    if (*capacite >= minimum) return true;
+    size_t nouvelle = *capacite;
+    while (nouvelle < minimum) nouvelle *= 2;
+    char *t = realloc(*tampon, nouvelle);
+    if (t == NULL) return false;
+    *tampon = t;
+    *capacite = nouvelle;
+    return true;
+}
+
+/**
+ * \brief Lit une ligne complète, de longueur quelconque
+ * \param flux Flux à lire (stdin en général)
+ * \return Chaîne allouée sans le '\n' final (à libérer avec free), NULL en fin de flux
+ *
+ * fgets() écrit directement à la suite des caractères déjà lus:
+ * aucune recopie de l'entrée hormis les éventuels realloc.
+ */
+char *lire_ligne(FILE *flux) {
+    size_t capacite = TAILLE_LECTURE_INITIALE;
+    size_t longueur = 0;
+    char *tampon = malloc(capacite);
+    if (tampon == NULL) return NULL;
+
+    while (1) {
+        // fgets prend un int: morceaux d'au plus INT_MAX octets
+        size_t libre = capacite - longueur;
+        if (libre > INT_MAX) libre = INT_MAX;
+        if (fgets(tampon + longueur, (int)libre, flux) == NULL) break;
+
+        longueur += strlen(tampon + longueur);
+        if (longueur > 0 && tampon[longueur - 1] == '\n') {
+            tampon[--longueur] = '\0';
+            return tampon;
+        }
+        // Ligne pas encore terminée: faire de la place pour la suite si le tampon est plein
+        if (capacite - longueur < 2 && !agrandir_tampon(&tampon, &capacite, capacite * 2)) break;
+    }
+
+    if (longueur == 0) {
+        free(tampon);
+        return NULL;
+    }
+    return tampon;
+}
+
+/**
+ * \brief Charge le contenu complet d'un fichier texte
+ * \param chemin Chemin du fichier
+ * \return Contenu alloué et terminé par '\0' (à libérer avec free), NULL en cas d'erreur
+ *
+ * Le fichier est lu par gros blocs avec fread() directement dans le tampon
+ * final; fonctionne aussi pour les flux non positionnables (tubes).
+ */
+char *lire_fichier(const char *chemin) {
+    FILE *f = fopen(chemin, "r");
+    if (f == NULL) return NULL;
+
+    size_t capacite = TAILLE_LECTURE_INITIALE;
+    size_t longueur = 0;
+    char *tampon = malloc(capacite);
+
+    // Pré-dimensionner si la taille du fichier est connue
+    if (tampon != NULL && fseek(f, 0, SEEK_END) == 0) {
+        long taille = ftell(f);
+        if (taille > 0) agrandir_tampon(&tampon, &capacite, (size_t)taille + 1);
+        rewind(f);
+    }
+
+    while (tampon != NULL) {
+        if (longueur + 1 >= capacite && !agrandir_tampon(&tampon, &capacite, capacite * 2)) {
+            free(tampon);
+            tampon = NULL;
+            break;
+        }
+        size_t lu = fread(tampon + longueur, 1, capacite - 1 - longueur, f);
+        longueur += lu;
+        if (lu == 0) break;
+    }
+
+    if (tampon != NULL) {
+        if (ferror(f)) {
+            free(tampon);
+            tampon = NULL;
+        } else {
+            tampon[longueur] = '\0';
+        }
+    }
+    fclose(f);
+    return tampon;
+}
+
+/**
+ * \brief Lit une opérande au clavier, ou depuis un fichier si l'entrée commence par '@'
  * \param message Message à afficher avant la saisie
+ * \return Texte alloué (à libérer avec free), NULL en cas d'erreur
  *
- * Utilise fgets() pour une lecture sécurisée et supprime
- * le caractère de retour à la ligne (\n) à la fin.
+ * Exemple: "@cle.txt" charge le contenu de cle.txt.
+ * Aucune limite de taille: le tampon grandit selon les besoins.
  */
-void lire_binaire(char *buffer, int taille, const char *message) {
+char *lire_operande(const char *message) {
     printf("%s", message);
 
-    // Lire l'entrée utilisateur avec fgets (plus sûr que scanf)
-    if (fgets(buffer, taille, stdin) != NULL) {
-        // Supprimer le retour à la ligne (\n) à la fin de la chaîne
-        // fgets inclut le \n dans la chaîne si l'entrée est courte enough
-        size_t len = strlen(buffer);
-        if (len > 0 && buffer[len-1] == '\n') {
-            buffer[len-1] = '\0';  // Remplacer \n par \0 (fin de chaîne)
-        }
+    char *ligne = lire_ligne(stdin);
+    if (ligne == NULL || ligne[0] != '@') return ligne;
+
+    // Chargement depuis un fichier: ignorer les espaces autour du chemin
+    char *chemin = ligne + 1;
+    while (*chemin == ' ' || *chemin == '\t') chemin++;
+    size_t n = strlen(chemin);
+    while (n > 0 && (chemin[n - 1] == ' ' || chemin[n - 1] == '\t' || chemin[n - 1] == '\r')) {
+        chemin[--n] = '\0';
     }
+
+    char *contenu = lire_fichier(chemin);
+    if (contenu == NULL) {
+        printf("Impossible de lire le fichier '%s'.\n", chemin);
+    }
+    free(ligne);
+    return contenu;
 }
 
 /**
@@ -136,46 +247,40 @@ char choisir_format_entree(const char *message) {
  * \param format 'b' pour binaire, 'd' pour décimal
  * \return Le nombre lu sous forme de BigBinary
  *
- * Si format = 'd': lit un entier long long et utilise creerBigBinaryDepuisDecimal()
+ * Si format = 'd': lit une chaîne décimale et utilise creerBigBinaryDepuisChaineDecimale()
  * Si format = 'b': lit une chaîne binaire et utilise creerBigBinaryDepuisChaine()
+ * Si l'entrée commence par '@', l'opérande est chargée depuis le fichier indiqué.
  *
  * En cas d'erreur de lecture, retourne zéro.
  */
 BigBinary lire_nombre(const char *message, char format) {
-    char buffer[BUFFER_SIZE];
-
     printf("%s", message);
+    char *texte = lire_operande(format == 'd' ? "(décimal, ou @fichier): " : "(binaire, ou @fichier): ");
+    BigBinary nb;
 
     if (format == 'd') {
         // === ENTRÉE DÉCIMALE ===
-        printf("(décimal): ");
-        if (fgets(buffer, sizeof(buffer), stdin) != NULL) {
-            long long valeur;
-            // %lld est le format pour long long
-            if (sscanf(buffer, "%lld", &valeur) == 1) {
-                // Conversion décimal -> BigBinary avec notre nouvelle fonction
-                return creerBigBinaryDepuisDecimal(valeur);
-            }
+        // Il faut au moins un chiffre (taille non limitée à long long)
+        if (texte != NULL && strpbrk(texte, "0123456789") != NULL) {
+            // Conversion décimal -> BigBinary de taille quelconque
+            nb = creerBigBinaryDepuisChaineDecimale(texte);
+            free(texte);
+            return nb;
         }
-        // Erreur: utiliser 0 par défaut
-        printf("Entrée invalide. Utilisation de 0 par défaut.\n");
-        return creerZero();
     } else {
         // === ENTRÉE BINAIRE ===
-        printf("(binaire): ");
-        if (fgets(buffer, sizeof(buffer), stdin) != NULL) {
-            // Supprimer le retour à la ligne
-            size_t len = strlen(buffer);
-            if (len > 0 && buffer[len-1] == '\n') {
-                buffer[len-1] = '\0';
-            }
-            // Conversion chaîne binaire -> BigBinary
-            return creerBigBinaryDepuisChaine(buffer);
+        if (texte != NULL) {
+            // Conversion chaîne binaire -> BigBinary (les sauts de ligne sont ignorés)
+            nb = creerBigBinaryDepuisChaine(texte);
+            free(texte);
+            return nb;
         }
-        // Erreur: utiliser 0 par défaut
-        printf("Entrée invalide. Utilisation de 0 par défaut.\n");
-        return creerZero();
     }
+
+    // Erreur: utiliser 0 par défaut
+    free(texte);
+    printf("Entrée invalide. Utilisation de 0 par défaut.\n");
+    return creerZero();
 }
 
 // ============================================================================
@@ -224,7 +329,7 @@ void test_addition() {
 }
 
 /**
- * \brief Teste la soustraction de deux BigBinary (A >= B requis)
+ * \brief Teste la soustraction de deux BigBinary
  *
  * === Phase 1, §5.1: Soustraction ===
  *
@@ -232,8 +337,7 @@ void test_addition() {
  * - On soustrait bit par bit de droite à gauche
  * - Si le bit de A est plus petit, on "emprunte" 1 au bit suivant
  *
- * Note: La soustraction donne un résultat négatif si A < B,
- * mais notre implémentation ne supporte pas les nombres négatifs.
+ * Note: Si A < B, le résultat est négatif (la soustraction est signée).
  */
 void test_soustraction() {
     char format;
@@ -249,17 +353,12 @@ void test_soustraction() {
     printf("B = ");
     afficheBigBinary(B);
 
-    // Vérifier que A >= B (notre fonction ne supporte pas A < B)
-    if (Inferieur(A, B)) {
-        printf("\nERREUR: A < B. La soustraction nécessite A >= B.\n");
-    } else {
-        // Effectuer la soustraction
-        BigBinary resultat = Soustraction(A, B);
-        printf("\nA - B = ");
-        afficheBigBinary(resultat);
-        libereBigBinary(&resultat);
-    }
+    // Effectuer la soustraction (résultat négatif si A < B)
+    BigBinary resultat = Soustraction(A, B);
+    printf("\nA - B = ");
+    afficheBigBinary(resultat);
 
+    libereBigBinary(&resultat);
     libereBigBinary(&A);
     libereBigBinary(&B);
 }
@@ -0,0 +1,1508 @@
+/**
+ * \file parallele.c
+ * \brief Pool de threads POSIX et traitements par lots
+ *
+ * Les fonctions de bigbinary.c n'ont aucun état global modifiable: elles
+ * peuvent être appelées depuis plusieurs threads à la fois, sur des
+ * opérandes partagés en lecture (les compteurs de copie sur écriture
+ * sont atomiques).
+ *
+ * === Pool de threads ===
+ * - Threads créés une seule fois et réveillés pour chaque lot
+ * - Distribution dynamique des indices (un thread libre prend le suivant)
+ * - Sous-calculs d'une même opération (Karatsuba) répartis par vol de
+ *   tâches entre des files par thread
+ * - Mémoire de travail par thread: chaque travailleur installe son propre
+ *   allocateur (cache de blocs libres), sans contention entre threads
+ */
+
+// pthread, sysconf
+#define _POSIX_C_SOURCE 200809L
+#if defined(__APPLE__)
+#define _DARWIN_C_SOURCE
+#endif
+
+#include "parallele.h"
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+// ============================================================================
+// ============== AJOUT: MÉMOIRE DE TRAVAIL PAR THREAD (CACHE) ================
+// ============================================================================
+
+/*
+ * Chaque travailleur garde les blocs qu'il libère dans des listes par
+ * classe de taille (puissances de 2 à partir de 64 octets) et les
+ * réutilise pour ses allocations suivantes: les milliers de tableaux
+ * temporaires d'une exponentiation ne repassent pas par malloc.
+ * Les blocs viennent de l'allocateur global en place à la création du
+ * pool (definirAllocateur est donc respecté), arrondis à leur classe et
+ * alignés sur 64 octets: un bloc libéré depuis un autre thread lui est
+ * simplement rendu.
+ */
+
+#define TAILLE_MIN_CACHE 64
+#define NB_CLASSES_CACHE 20      // 64 o .. 32 Mo
+#define MAX_BLOCS_PAR_CLASSE 64
+#define ALIGNEMENT_CACHE 64
+
+typedef struct BlocLibre {
+    struct BlocLibre *suivant;
+} BlocLibre;
+
+typedef struct {
+    BlocLibre *libres[NB_CLASSES_CACHE];
+    int nbLibres[NB_CLASSES_CACHE];
+    pthread_t proprietaire;
+    const AllocateurBigBinary *source;  // Allocateur global qui fournit les blocs
+} CacheMemoire;
+
+/**
+ * \brief Classe de taille d'un bloc (NB_CLASSES_CACHE si trop grand pour le cache)
+ */
+static int classeTaille(size_t taille) {
+    int c = 0;
+    size_t capacite = TAILLE_MIN_CACHE;
+    while (capacite < taille && c < NB_CLASSES_CACHE) {
+        capacite <<= 1;
+        c++;
+    }
+    return c;
+}
+
+static void *allouerCache(size_t taille, size_t alignement, void *contexte) {
+    CacheMemoire *cache = contexte;
+    int c = classeTaille(taille);
+
+    if (alignement <= ALIGNEMENT_CACHE && c < NB_CLASSES_CACHE) {
+        // allouerCache n'est installé que sur le thread propriétaire: pas de verrou
+        if (cache->libres[c] != NULL) {
+            BlocLibre *bloc = cache->libres[c];
+            cache->libres[c] = bloc->suivant;
+            cache->nbLibres[c]--;
+            return bloc;
+        }
+        taille = (size_t)TAILLE_MIN_CACHE << c;
+    }
+
+    if (alignement < ALIGNEMENT_CACHE) alignement = ALIGNEMENT_CACHE;
+    return cache->source->allouer(taille, alignement, cache->source->contexte);
+}
+
+static void libererCache(void *ptr, size_t taille, size_t alignement, void *contexte) {
+    CacheMemoire *cache = contexte;
+    int c = classeTaille(taille);
+
+    if (alignement <= ALIGNEMENT_CACHE && c < NB_CLASSES_CACHE) {
+        // Remise en cache seulement par le thread propriétaire (pas de
+        // verrou): les compteurs ne sont lus qu'une fois ce point vérifié
+        if (pthread_equal(pthread_self(), cache->proprietaire) &&
+            cache->nbLibres[c] < MAX_BLOCS_PAR_CLASSE) {
+            BlocLibre *bloc = ptr;
+            bloc->suivant = cache->libres[c];
+            cache->libres[c] = bloc;
+            cache->nbLibres[c]++;
+            return;
+        }
+        taille = (size_t)TAILLE_MIN_CACHE << c;  // Taille réellement allouée
+    }
+    if (alignement < ALIGNEMENT_CACHE) alignement = ALIGNEMENT_CACHE;
+    cache->source->liberer(ptr, taille, alignement, cache->source->contexte);
+}
+
+/**
+ * \brief Rend à l'allocateur source tous les blocs gardés en cache
+ */
+static void viderCache(CacheMemoire *cache) {
+    for (int c = 0; c < NB_CLASSES_CACHE; ++c) {
+        while (cache->libres[c] != NULL) {
+            BlocLibre *bloc = cache->libres[c];
+            cache->libres[c] = bloc->suivant;
+            cache->source->liberer(bloc, (size_t)TAILLE_MIN_CACHE << c, ALIGNEMENT_CACHE,
+                                   cache->source->contexte);
+        }
+        cache->nbLibres[c] = 0;
+    }
+}
+
+// ============================================================================
+// ========================== AJOUT: POOL DE THREADS ==========================
+// ============================================================================
+
+/*
+ * Deux façons de donner du travail au pool:
+ * - executerLot: un lot d'indices indépendants, distribués un par un
+ * - les sous-tâches (exécuteur de sous-calculs): chaque thread pousse les
+ *   siennes dans sa propre file à deux bouts (deque), les reprend par le
+ *   bas (dernière poussée, encore en cache) et, s'il n'a plus rien, vole
+ *   par le haut dans la file des autres (les plus anciennes, donc les plus
+ *   grosses dans une récursion). Un thread qui attend la fin de ses
+ *   sous-tâches en exécute d'autres au lieu de dormir: les appels
+ *   imbriqués ne peuvent pas bloquer le pool.
+ * Les threads extérieurs au pool passent par une file commune.
+ */
+
+struct GroupeTaches;
+
+typedef struct {
+    SousTache tache;
+    int indice;
+    void *contexte;
+    struct GroupeTaches *groupe;
+} TacheVolable;
+
+// Sous-tâches d'un même appel à l'exécuteur (groupe NULL: tâche isolée, voir Futur)
+typedef struct GroupeTaches {
+    int restants;  // Atomique
+} GroupeTaches;
+
+// File à deux bouts, tableau circulaire protégé par un verrou
+typedef struct {
+    pthread_mutex_t verrou;
+    TacheVolable *taches;
+    int capacite;
+    int debut;   // Plus ancienne (côté vol)
+    int nombre;
+} Deque;
+
+typedef struct {
+    PoolThreads *pool;
+    int numero;
+    pthread_t thread;
+    CacheMemoire cache;
+    AllocateurBigBinary allocateur;  // Allocateur du thread (sur cache)
+    Deque deque;                     // Sous-tâches poussées par ce thread
+} Travailleur;
+
+struct PoolThreads {
+    int nbThreads;
+    Travailleur *travailleurs;
+
+    pthread_mutex_t verrou;
+    pthread_cond_t travailDisponible;
+    pthread_cond_t lotTermine;
+    pthread_mutex_t verrouLot;     // Un seul lot à la fois
+
+    // Lot en cours (protégé par verrou)
+    TacheIndice tache;
+    void *contexte;
+    int nb;
+    int prochain;                  // Prochain indice à distribuer
+    int termines;                  // Indices traités
+    unsigned long generation;      // Incrémenté à chaque nouveau lot
+    bool arret;
+
+    // Sous-tâches
+    ExecuteurBigBinary executeur;  // Installé sur chaque travailleur
+    Deque fileExterne;             // Sous-tâches des threads hors du pool
+    int tachesEnFile;              // Total dans toutes les files (atomique)
+};
+
+// Travailleur exécuté par le thread courant (NULL hors de tout pool)
+static __thread Travailleur *travailleurCourant = NULL;
+
+static void initialiserDeque(Deque *d) {
+    pthread_mutex_init(&d->verrou, NULL);
+    d->taches = NULL;
+    d->capacite = 0;
+    d->debut = 0;
+    d->nombre = 0;
+}
+
+static void detruireDeque(Deque *d) {
+    pthread_mutex_destroy(&d->verrou);
+    free(d->taches);
+}
+
+/**
+ * \brief Ajoute une tâche au bas de la file (côté propriétaire)
+ * \return false si la file n'a pas pu grandir
+ */
+static bool pousserTache(PoolThreads *pool, Deque *d, TacheVolable tache) {
+    pthread_mutex_lock(&d->verrou);
+    if (d->nombre == d->capacite) {
+        int capacite = d->capacite ? 2 * d->capacite : 16;
+        TacheVolable *taches = malloc(sizeof(TacheVolable) * (size_t)capacite);
+        if (taches == NULL) {
+            pthread_mutex_unlock(&d->verrou);
+            return false;
+        }
+        for (int i = 0; i < d->nombre; ++i) {
+            taches[i] = d->taches[(d->debut + i) % d->capacite];
+        }
+        free(d->taches);
+        d->taches = taches;
+        d->capacite = capacite;
+        d->debut = 0;
+    }
+    d->taches[(d->debut + d->nombre) % d->capacite] = tache;
+    d->nombre++;
+    __atomic_add_fetch(&pool->tachesEnFile, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&d->verrou);
+    return true;
+}
+
+/**
+ * \brief Retire une tâche par le bas (proprietaire = true) ou par le haut (vol)
+ */
+static bool retirerTache(PoolThreads *pool, Deque *d, bool proprietaire, TacheVolable *tache) {
+    pthread_mutex_lock(&d->verrou);
+    if (d->nombre == 0) {
+        pthread_mutex_unlock(&d->verrou);
+        return false;
+    }
+    if (proprietaire) {
+        *tache = d->taches[(d->debut + d->nombre - 1) % d->capacite];
+    } else {
+        *tache = d->taches[d->debut];
+        d->debut = (d->debut + 1) % d->capacite;
+    }
+    d->nombre--;
+    __atomic_sub_fetch(&pool->tachesEnFile, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&d->verrou);
+    return true;
+}
+
+/**
+ * \brief Cherche une sous-tâche: d'abord dans sa propre file, puis chez les autres
+ * \param propre File du thread appelant
+ */
+static bool trouverTache(PoolThreads *pool, Deque *propre, TacheVolable *tache) {
+    if (retirerTache(pool, propre, true, tache)) return true;
+
+    // Vol en commençant par le voisin, pour ne pas tous viser le même thread
+    Travailleur *t = travailleurCourant;
+    int depart = (t != NULL && t->pool == pool) ? t->numero + 1 : 0;
+    for (int k = 0; k < pool->nbThreads; ++k) {
+        Deque *d = &pool->travailleurs[(depart + k) % pool->nbThreads].deque;
+        if (d != propre && retirerTache(pool, d, false, tache)) return true;
+    }
+    return propre != &pool->fileExterne && retirerTache(pool, &pool->fileExterne, false, tache);
+}
+
+static void reveillerPool(PoolThreads *pool) {
+    pthread_mutex_lock(&pool->verrou);
+    pthread_cond_broadcast(&pool->travailDisponible);
+    pthread_mutex_unlock(&pool->verrou);
+}
+
+static void executerTache(PoolThreads *pool, TacheVolable *tache) {
+    tache->tache(tache->indice, tache->contexte);
+    if (tache->groupe != NULL &&
+        __atomic_sub_fetch(&tache->groupe->restants, 1, __ATOMIC_ACQ_REL) == 0) {
+        reveillerPool(pool);  // Le thread qui attend ce groupe dort peut-être
+    }
+}
+
+/**
+ * \brief Attend la fin d'un groupe de sous-tâches
+ * \param propre File du thread appelant, qui aide en exécutant des tâches
+ *        en attendant (NULL: le thread dort jusqu'à la fin du groupe)
+ */
+static void attendreGroupe(PoolThreads *pool, GroupeTaches *groupe, Deque *propre) {
+    while (__atomic_load_n(&groupe->restants, __ATOMIC_ACQUIRE) > 0) {
+        TacheVolable autre;
+        if (propre != NULL && trouverTache(pool, propre, &autre)) {
+            executerTache(pool, &autre);
+            continue;
+        }
+        // Rien à voler: les tâches restantes sont en cours ailleurs
+        pthread_mutex_lock(&pool->verrou);
+        while (__atomic_load_n(&groupe->restants, __ATOMIC_ACQUIRE) > 0 &&
+               (propre == NULL || __atomic_load_n(&pool->tachesEnFile, __ATOMIC_SEQ_CST) == 0)) {
+            pthread_cond_wait(&pool->travailDisponible, &pool->verrou);
+        }
+        pthread_mutex_unlock(&pool->verrou);
+    }
+}
+
+/**
+ * \brief Exécuteur de sous-calculs du pool (voir ExecuteurBigBinary)
+ *
+ * Les sous-tâches 1..nb-1 sont poussées dans la file du thread appelant,
+ * qui exécute lui-même la sous-tâche 0 puis aide (ses propres tâches
+ * d'abord, sinon celles des autres) jusqu'à ce que le groupe soit fini.
+ */
+static void executerSousTaches(int nb, SousTache tache, void *contexteTache, void *contexte) {
+    PoolThreads *pool = contexte;
+    Travailleur *t = travailleurCourant;
+    Deque *propre = (t != NULL && t->pool == pool) ? &t->deque : &pool->fileExterne;
+
+    GroupeTaches groupe = {0};
+    for (int i = nb - 1; i >= 1; --i) {
+        TacheVolable sousTache = {tache, i, contexteTache, &groupe};
+        __atomic_add_fetch(&groupe.restants, 1, __ATOMIC_RELAXED);
+        if (!pousserTache(pool, propre, sousTache)) {
+            __atomic_sub_fetch(&groupe.restants, 1, __ATOMIC_RELAXED);
+            tache(i, contexteTache);  // Plus de mémoire: calcul sur place
+        }
+    }
+    if (nb > 1) reveillerPool(pool);
+
+    if (nb > 0) tache(0, contexteTache);
+    attendreGroupe(pool, &groupe, propre);
+}
+
+/**
+ * \brief Boucle d'un thread du pool: lots d'indices et sous-tâches à voler
+ *
+ * À l'arrêt du pool, les tâches encore en file sont exécutées d'abord
+ * (un futur en attente finit toujours par être terminé ou annulé).
+ */
+static void *boucleTravailleur(void *arg) {
+    Travailleur *t = arg;
+    PoolThreads *pool = t->pool;
+    unsigned long generationVue = 0;
+
+    // Mémoire de travail propre au thread, sous-calculs confiés au pool
+    t->cache.proprietaire = pthread_self();
+    definirAllocateurThread(&t->allocateur);
+    definirExecuteurThread(&pool->executeur);
+    travailleurCourant = t;
+
+    pthread_mutex_lock(&pool->verrou);
+    while (1) {
+        if (pool->generation != generationVue) {
+            generationVue = pool->generation;
+
+            while (pool->prochain < pool->nb) {
+                int i = pool->prochain++;
+                pthread_mutex_unlock(&pool->verrou);
+
+                pool->tache(i, t->numero, pool->contexte);
+
+                pthread_mutex_lock(&pool->verrou);
+                if (++pool->termines == pool->nb) {
+                    pthread_cond_broadcast(&pool->lotTermine);
+                }
+            }
+            continue;
+        }
+
+        if (__atomic_load_n(&pool->tachesEnFile, __ATOMIC_SEQ_CST) > 0) {
+            pthread_mutex_unlock(&pool->verrou);
+            TacheVolable tache;
+            if (trouverTache(pool, &t->deque, &tache)) executerTache(pool, &tache);
+            pthread_mutex_lock(&pool->verrou);
+            continue;
+        }
+
+        if (pool->arret) break;
+        pthread_cond_wait(&pool->travailDisponible, &pool->verrou);
+    }
+    pthread_mutex_unlock(&pool->verrou);
+
+    travailleurCourant = NULL;
+    definirExecuteurThread(NULL);
+    definirAllocateurThread(NULL);
+    return NULL;
+}
+
+/**
+ * \brief Nombre de cœurs disponibles (1 si inconnu)
+ */
+static int nombreCoeurs(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > 0) return (int)n;
+#endif
+    return 1;
+}
+
+/**
+ * \brief Crée un pool de threads
+ * \param nbThreads Nombre de threads (0 = nombre de cœurs disponibles)
+ * \return Le pool, ou NULL en cas d'échec
+ */
+PoolThreads *creerPoolThreads(int nbThreads) {
+    if (nbThreads <= 0) nbThreads = nombreCoeurs();
+
+    PoolThreads *pool = calloc(1, sizeof(PoolThreads));
+    if (pool == NULL) return NULL;
+    pool->travailleurs = calloc((size_t)nbThreads, sizeof(Travailleur));
+    if (pool->travailleurs == NULL) {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->verrou, NULL);
+    pthread_mutex_init(&pool->verrouLot, NULL);
+    pthread_cond_init(&pool->travailDisponible, NULL);
+    pthread_cond_init(&pool->lotTermine, NULL);
+    initialiserDeque(&pool->fileExterne);
+    pool->executeur.executer = executerSousTaches;
+    pool->executeur.contexte = pool;
+
+    for (int i = 0; i < nbThreads; ++i) {
+        Travailleur *t = &pool->travailleurs[i];
+        t->pool = pool;
+        t->numero = i;
+        t->allocateur.allouer = allouerCache;
+        t->allocateur.reallouer = NULL;  // allocation + copie + libération
+        t->allocateur.liberer = libererCache;
+        t->allocateur.contexte = &t->cache;
+        t->cache.source = allocateurGlobalCourant();
+        initialiserDeque(&t->deque);
+        if (pthread_create(&t->thread, NULL, boucleTravailleur, t) != 0) {
+            detruireDeque(&t->deque);
+            break;
+        }
+        pool->nbThreads++;
+    }
+
+    if (pool->nbThreads == 0) {
+        detruirePoolThreads(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/**
+ * \brief Arrête les threads du pool et libère sa mémoire
+ * \param pool Pool à détruire (peut être NULL)
+ */
+void detruirePoolThreads(PoolThreads *pool) {
+    if (pool == NULL) return;
+
+    pthread_mutex_lock(&pool->verrou);
+    pool->arret = true;
+    pthread_cond_broadcast(&pool->travailDisponible);
+    pthread_mutex_unlock(&pool->verrou);
+
+    for (int i = 0; i < pool->nbThreads; ++i) {
+        pthread_join(pool->travailleurs[i].thread, NULL);
+        viderCache(&pool->travailleurs[i].cache);
+    }
+
+    for (int i = 0; i < pool->nbThreads; ++i) detruireDeque(&pool->travailleurs[i].deque);
+    detruireDeque(&pool->fileExterne);
+    pthread_mutex_destroy(&pool->verrou);
+    pthread_mutex_destroy(&pool->verrouLot);
+    pthread_cond_destroy(&pool->travailDisponible);
+    pthread_cond_destroy(&pool->lotTermine);
+    free(pool->travailleurs);
+    free(pool);
+}
+
+/**
+ * \brief Nombre de threads du pool
+ */
+int nombreThreadsPool(const PoolThreads *pool) {
+    return pool->nbThreads;
+}
+
+/**
+ * \brief Exécuteur de sous-calculs qui répartit le travail sur le pool
+ *
+ * À installer avec definirExecuteurThread() pour que les très grandes
+ * multiplications du thread courant (et tout ce qui les utilise: ExpMod,
+ * DivisionEuclidienne...) occupent tous les threads du pool. Les
+ * travailleurs du pool l'ont déjà installé pour eux-mêmes.
+ */
+const ExecuteurBigBinary *executeurPool(PoolThreads *pool) {
+    return &pool->executeur;
+}
+
+/**
+ * \brief Exécute une tâche pour chaque indice d'un lot, en parallèle
+ * \param pool Pool de threads
+ * \param nb Nombre d'indices (tache est appelée pour 0..nb-1)
+ * \param tache Fonction appelée avec (indice, numéro du travailleur, contexte)
+ * \param contexte Donnée transmise à chaque appel
+ *
+ * Les indices sont distribués un par un au premier thread libre: les
+ * tâches longues ou de durée variable restent bien réparties. La
+ * fonction rend la main quand toutes les tâches sont terminées.
+ */
+void executerLot(PoolThreads *pool, int nb, TacheIndice tache, void *contexte) {
+    if (nb <= 0) return;
+
+    pthread_mutex_lock(&pool->verrouLot);
+    pthread_mutex_lock(&pool->verrou);
+
+    pool->tache = tache;
+    pool->contexte = contexte;
+    pool->nb = nb;
+    pool->prochain = 0;
+    pool->termines = 0;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->travailDisponible);
+
+    while (pool->termines < pool->nb) {
+        pthread_cond_wait(&pool->lotTermine, &pool->verrou);
+    }
+
+    pthread_mutex_unlock(&pool->verrou);
+    pthread_mutex_unlock(&pool->verrouLot);
+}
+
+// ============================================================================
+// ============================ AJOUT: RSA PAR LOTS ===========================
+// ============================================================================
+
+typedef struct {
+    PoolThreads *pool;
+    const BigBinary *entrees;
+    BigBinary *sorties;
+    int nb;
+    BigBinary exposant;
+    BigBinary module;
+} LotRSA;
+
+/**
+ * \brief Copie un résultat hors de la mémoire de travail du thread
+ *
+ * Le résultat survit au pool: il est recopié avec l'allocateur global
+ * (une copie linéaire, négligeable devant l'exponentiation), puis
+ * l'original retourne dans le cache du travailleur. L'allocateur du
+ * thread est remis tel quel: une tâche volée pendant qu'une autre
+ * l'avait déjà changé ne doit pas réinstaller celui du travailleur.
+ */
+static BigBinary exporterResultat(BigBinary r) {
+    const AllocateurBigBinary *precedent = allocateurThreadCourant();
+    definirAllocateurThread(NULL);
+    BigBinary copie = copieBigBinary(vueBigBinary(r.Tdigits, r.Taille, r.Signe));
+    definirAllocateurThread(precedent);
+
+    libereBigBinary(&r);
+    return copie;
+}
+
+/**
+ * \brief Tâche d'un lot RSA: un groupe de BIGBINARY_LARGEUR_LOT messages
+ *
+ * Le groupe est calculé en une fois par ExpModLot (une voie SIMD par message).
+ */
+static void tacheRSA(int groupe, int travailleur, void *contexte) {
+    (void)travailleur;
+    LotRSA *lot = contexte;
+    int debut = groupe * BIGBINARY_LARGEUR_LOT;
+    int nbVoies = lot->nb - debut < BIGBINARY_LARGEUR_LOT ? lot->nb - debut : BIGBINARY_LARGEUR_LOT;
+
+    BigBinary exposants[BIGBINARY_LARGEUR_LOT];
+    BigBinary r[BIGBINARY_LARGEUR_LOT];
+    for (int v = 0; v < nbVoies; ++v) exposants[v] = lot->exposant;
+
+    ExpModLot(lot->entrees + debut, exposants, r, nbVoies, lot->module);
+    for (int v = 0; v < nbVoies; ++v) {
+        lot->sorties[debut + v] = exporterResultat(r[v]);
+    }
+}
+
+static void executerLotRSA(LotRSA *lot) {
+    int nbGroupes = (lot->nb + BIGBINARY_LARGEUR_LOT - 1) / BIGBINARY_LARGEUR_LOT;
+    executerLot(lot->pool, nbGroupes, tacheRSA, lot);
+}
+
+/**
+ * \brief Chiffre un lot de messages avec la même clé publique
+ * \param pool Pool de threads
+ * \param messages Messages à chiffrer
+ * \param chiffres Reçoit les messages chiffrés, dans le même ordre (à libérer)
+ * \param nb Nombre de messages
+ * \param e Exposant public
+ * \param n Module RSA
+ *
+ * Les messages sont répartis par groupes de BIGBINARY_LARGEUR_LOT entre
+ * les threads (voir ExpModLot); la clé est partagée en lecture seule.
+ */
+void RSA_encryptLot(PoolThreads *pool, const BigBinary *messages, BigBinary *chiffres, int nb,
+                    BigBinary e, BigBinary n) {
+    LotRSA lot = {pool, messages, chiffres, nb, e, n};
+    executerLotRSA(&lot);
+}
+
+/**
+ * \brief Déchiffre un lot de messages avec la même clé privée
+ * \param pool Pool de threads
+ * \param chiffres Messages chiffrés
+ * \param messages Reçoit les messages clairs, dans le même ordre (à libérer)
+ * \param nb Nombre de messages
+ * \param d Exposant privé
+ * \param n Module RSA
+ */
+void RSA_decryptLot(PoolThreads *pool, const BigBinary *chiffres, BigBinary *messages, int nb,
+                    BigBinary d, BigBinary n) {
+    LotRSA lot = {pool, chiffres, messages, nb, d, n};
+    executerLotRSA(&lot);
+}
+
+// ============================================================================
+// ============ AJOUT: MULTIPLICATION PARALLÈLE DES TRÈS GRANDS NOMBRES =======
+// ============================================================================
+
+/**
+ * \brief Produit A * B dont les sous-produits sont répartis sur le pool
+ * \param pool Pool de threads
+ * \param A Premier opérande
+ * \param B Second opérande
+ * \return Nouveau BigBinary égal à A * B
+ *
+ * Même résultat que MultiplicationEgyptienne. Au-delà de 128 Kbits, chaque
+ * niveau de Karatsuba produit trois sous-produits indépendants, volés par
+ * les threads libres; en dessous, le calcul reste séquentiel (le coût de
+ * synchronisation dépasserait le gain).
+ */
+BigBinary MultiplicationParallele(PoolThreads *pool, BigBinary A, BigBinary B) {
+    const ExecuteurBigBinary *precedent = executeurCourant();
+    definirExecuteurThread(&pool->executeur);
+    BigBinary produit = MultiplicationEgyptienne(A, B);
+    definirExecuteurThread(precedent);
+    return produit;
+}
+
+// ============================================================================
+// ======== AJOUT: TRAVAUX EN MASSE (PGCD, MODULO) PAR VOL DE TÂCHES ==========
+// ============================================================================
+
+/*
+ * Le coût d'un PGCD ou d'un Modulo varie de plusieurs ordres de grandeur
+ * avec la taille des opérandes: un découpage statique laisserait des
+ * threads inactifs. Les travaux sont groupés en tranches (assez pour
+ * amortir la synchronisation, assez peu pour que le vol équilibre),
+ * distribuées au départ à tour de rôle dans les files des threads; un
+ * thread qui a vidé la sienne vole les tranches les plus anciennes des
+ * autres. La mémoire de travail de chaque thread est son cache de blocs
+ * (voir CacheMemoire): les temporaires d'une opération sont réutilisés
+ * par la suivante sans repasser par malloc.
+ */
+
+#define TRANCHES_PAR_THREAD 16
+#define TRAVAUX_PAR_TRANCHE_MAX 64
+
+typedef struct {
+    PoolThreads *pool;
+    Travail *travaux;
+    int nb;
+    int tailleTranche;
+    int nbThreads;
+    StatistiquesTravailleur *stats;  // Une entrée par thread, écrite par lui seul
+} LotTravaux;
+
+static double secondesMonotones(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+/**
+ * \brief Calcule un travail; le résultat sort de la mémoire du travailleur t (si non NULL)
+ */
+static void calculerTravail(Travail *travail, Travailleur *t) {
+    BigBinary r = (travail->type == TRAVAIL_PGCD) ? PGCD(travail->a, travail->b)
+                                                  : Modulo(travail->a, travail->b);
+    travail->resultat = (t != NULL) ? exporterResultat(r) : r;
+}
+
+/**
+ * \brief Sous-tâche: une tranche de travaux, exécutée par un thread du pool
+ *        (ou par un thread extérieur qui vole en attendant)
+ */
+static void tacheTranche(int tranche, void *contexteTache) {
+    LotTravaux *lot = contexteTache;
+    Travailleur *t = travailleurCourant;
+    int debut = tranche * lot->tailleTranche;
+    int fin = debut + lot->tailleTranche < lot->nb ? debut + lot->tailleTranche : lot->nb;
+
+    double depart = secondesMonotones();
+    for (int i = debut; i < fin; ++i) calculerTravail(&lot->travaux[i], t);
+
+    // Tranche volée par un thread qui n'est pas un travailleur de ce pool
+    // (un thread extérieur aide en attendant ses propres sous-tâches):
+    // calculée, mais sans fiche où la compter
+    if (t == NULL || t->pool != lot->pool) return;
+
+    StatistiquesTravailleur *stats = &lot->stats[t->numero];
+    stats->travaux += fin - debut;
+    stats->secondesActives += secondesMonotones() - depart;
+    if (tranche % lot->nbThreads != t->numero) stats->tranchesVolees++;
+}
+
+/**
+ * \brief Calcule un lot de PGCD / Modulo indépendants sur le pool
+ * \param pool Pool de threads
+ * \param travaux Descripteurs; le champ resultat de chacun est rempli (à libérer)
+ * \param nb Nombre de travaux
+ * \param stats Bilan par thread (nombreThreadsPool(pool) entrées), ou NULL
+ *
+ * Un thread extérieur au pool dort pendant le calcul; un travailleur du
+ * pool (appel imbriqué) participe. L'utilisation de chaque thread permet
+ * de vérifier l'équilibrage: des valeurs proches de 1 partout indiquent
+ * qu'aucun thread n'a attendu. Une tranche volée par un thread extérieur
+ * (qui attend ses propres sous-tâches sur le même pool) est calculée
+ * normalement mais ne figure dans aucun bilan.
+ */
+void executerTravaux(PoolThreads *pool, Travail *travaux, int nb, StatistiquesTravailleur *stats) {
+    int nbThreads = pool->nbThreads;
+    StatistiquesTravailleur *compteurs = calloc((size_t)nbThreads, sizeof(StatistiquesTravailleur));
+    if (compteurs == NULL) {
+        for (int i = 0; i < nb; ++i) calculerTravail(&travaux[i], NULL);
+        if (stats != NULL) memset(stats, 0, sizeof(StatistiquesTravailleur) * (size_t)nbThreads);
+        return;
+    }
+
+    int tailleTranche = 1;
+    if (nb > nbThreads * TRANCHES_PAR_THREAD) {
+        tailleTranche = (nb + nbThreads * TRANCHES_PAR_THREAD - 1) / (nbThreads * TRANCHES_PAR_THREAD);
+        if (tailleTranche > TRAVAUX_PAR_TRANCHE_MAX) tailleTranche = TRAVAUX_PAR_TRANCHE_MAX;
+    }
+    int nbTranches = nb > 0 ? (nb + tailleTranche - 1) / tailleTranche : 0;
+    LotTravaux lot = {pool, travaux, nb, tailleTranche, nbThreads, compteurs};
+
+    double depart = secondesMonotones();
+    GroupeTaches groupe = {0};
+    for (int i = 0; i < nbTranches; ++i) {
+        TacheVolable tranche = {tacheTranche, i, &lot, &groupe};
+        __atomic_add_fetch(&groupe.restants, 1, __ATOMIC_RELAXED);
+        if (!pousserTache(pool, &pool->travailleurs[i % nbThreads].deque, tranche)) {
+            // Plus de mémoire pour la file: calcul sur place, hors statistiques
+            __atomic_sub_fetch(&groupe.restants, 1, __ATOMIC_RELAXED);
+            int fin = (i + 1) * tailleTranche < nb ? (i + 1) * tailleTranche : nb;
+            for (int j = i * tailleTranche; j < fin; ++j) calculerTravail(&travaux[j], NULL);
+        }
+    }
+    reveillerPool(pool);
+
+    Travailleur *t = travailleurCourant;
+    attendreGroupe(pool, &groupe, (t != NULL && t->pool == pool) ? &t->deque : NULL);
+    double duree = secondesMonotones() - depart;
+
+    if (stats != NULL) {
+        for (int i = 0; i < nbThreads; ++i) {
+            stats[i] = compteurs[i];
+            stats[i].utilisation = duree > 0 ? compteurs[i].secondesActives / duree : 0;
+        }
+    }
+    free(compteurs);
+}
+
+// ============================================================================
+// ================= AJOUT: CALCULS ASYNCHRONES (FUTURS) ======================
+// ============================================================================
+
+/*
+ * Un futur est une tâche isolée (sans groupe) poussée dans les files du
+ * pool; l'appelant récupère la main immédiatement. Il garde deux
+ * références: celle de l'appelant (libererFutur) et celle de la tâche,
+ * rendue quand elle a été exécutée ou sautée. Un futur annulé reste donc
+ * dans la file jusqu'à ce qu'un thread le retire, sans rien calculer.
+ *
+ * Le calcul se fait avec l'allocateur global et non avec le cache du
+ * travailleur: le résultat est remis tel quel à l'appelant, sans copie.
+ */
+
+typedef enum {
+    OPERATION_EXPMOD,
+    OPERATION_DIVISION
+} OperationFutur;
+
+struct Futur {
+    PoolThreads *pool;
+    OperationFutur operation;
+    BigBinary operandes[3];     // Copies (partagées) des arguments
+    BigBinary resultat;         // Structures nulles tant que rien n'est calculé
+    BigBinary reste;
+    int etat;                   // EtatFutur (atomique)
+    int references;             // Appelant + tâche (atomique)
+    RappelFutur rappel;
+    void *contexteRappel;
+
+    pthread_mutex_t verrou;     // Protège evenement et les réveils
+    pthread_cond_t fini;
+    int evenement;              // eventfd signalé à la fin, -1 si non demandé
+};
+
+static bool futurFini(const Futur *futur) {
+    int etat = __atomic_load_n(&futur->etat, __ATOMIC_ACQUIRE);
+    return etat == FUTUR_TERMINE || etat == FUTUR_ANNULE;
+}
+
+static void signalerEvenement(int descripteur) {
+#if defined(__linux__)
+    uint64_t un = 1;
+    ssize_t ecrit = write(descripteur, &un, sizeof un);
+    (void)ecrit;  // Compteur saturé: le descripteur est déjà lisible
+#else
+    (void)descripteur;
+#endif
+}
+
+/**
+ * \brief Passe le futur dans son état final et réveille ceux qui l'attendent
+ */
+static void finirFutur(Futur *futur, EtatFutur etat) {
+    pthread_mutex_lock(&futur->verrou);
+    __atomic_store_n(&futur->etat, etat, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&futur->fini);
+    if (futur->evenement >= 0) signalerEvenement(futur->evenement);
+    pthread_mutex_unlock(&futur->verrou);
+}
+
+static void relacherFutur(Futur *futur) {
+    if (__atomic_sub_fetch(&futur->references, 1, __ATOMIC_ACQ_REL) > 0) return;
+
+    for (int i = 0; i < 3; ++i) libereBigBinary(&futur->operandes[i]);
+    libereBigBinary(&futur->resultat);
+    libereBigBinary(&futur->reste);
+#if defined(__linux__)
+    if (futur->evenement >= 0) close(futur->evenement);
+#endif
+    pthread_mutex_destroy(&futur->verrou);
+    pthread_cond_destroy(&futur->fini);
+    free(futur);
+}
+
+/**
+ * \brief Tâche d'un futur: calcule sauf s'il a été annulé entre-temps
+ */
+static void tacheFutur(int indice, void *contexteTache) {
+    (void)indice;
+    Futur *futur = contexteTache;
+
+    int attendu = FUTUR_EN_FILE;
+    if (__atomic_compare_exchange_n(&futur->etat, &attendu, FUTUR_EN_COURS, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        // Résultat alloué par l'allocateur global: il survit au pool. Celui
+        // du thread est remis tel quel ensuite (le futur a pu être volé par
+        // une tâche qui l'avait déjà changé)
+        const AllocateurBigBinary *precedent = allocateurThreadCourant();
+        definirAllocateurThread(NULL);
+
+        BigBinary *op = futur->operandes;
+        if (futur->operation == OPERATION_EXPMOD) {
+            futur->resultat = ExpMod(op[0], op[1], op[2]);
+        } else {
+            DivisionResult division = DivisionEuclidienne(op[0], op[1]);
+            futur->resultat = division.quotient;
+            futur->reste = division.reste;
+        }
+        for (int i = 0; i < 3; ++i) libereBigBinary(&op[i]);
+
+        definirAllocateurThread(precedent);
+
+        finirFutur(futur, FUTUR_TERMINE);
+        if (futur->rappel != NULL) futur->rappel(futur, futur->contexteRappel);
+    }
+    relacherFutur(futur);
+}
+
+/**
+ * \brief Crée un futur et met sa tâche en file (NULL en cas d'échec)
+ */
+static Futur *lancerFutur(PoolThreads *pool, OperationFutur operation, const BigBinary *operandes,
+                          int nbOperandes, RappelFutur rappel, void *contexte) {
+    Futur *futur = calloc(1, sizeof(Futur));
+    if (futur == NULL) return NULL;
+
+    futur->pool = pool;
+    futur->operation = operation;
+    for (int i = 0; i < nbOperandes; ++i) futur->operandes[i] = copieBigBinary(operandes[i]);
+    futur->etat = FUTUR_EN_FILE;
+    futur->references = 2;
+    futur->rappel = rappel;
+    futur->contexteRappel = contexte;
+    futur->evenement = -1;
+    pthread_mutex_init(&futur->verrou, NULL);
+    pthread_cond_init(&futur->fini, NULL);
+
+    Travailleur *t = travailleurCourant;
+    Deque *file = (t != NULL && t->pool == pool) ? &t->deque : &pool->fileExterne;
+    TacheVolable tache = {tacheFutur, 0, futur, NULL};
+    if (!pousserTache(pool, file, tache)) {
+        futur->references = 1;
+        relacherFutur(futur);
+        return NULL;
+    }
+    reveillerPool(pool);
+    return futur;
+}
+
+/**
+ * \brief Lance M^e mod n sur le pool sans attendre
+ * \param pool Pool de threads
+ * \param M Base
+ * \param e Exposant
+ * \param n Module
+ * \param rappel Fonction appelée (sur un thread du pool) quand le résultat est prêt, ou NULL
+ * \param contexte Transmis à rappel
+ * \return Le futur (à libérer avec libererFutur), NULL en cas d'échec
+ *
+ * Les arguments sont partagés (copie sur écriture): l'appelant peut les
+ * libérer ou les modifier aussitôt.
+ */
+Futur *lancerExpMod(PoolThreads *pool, BigBinary M, BigBinary e, BigBinary n,
+                    RappelFutur rappel, void *contexte) {
+    BigBinary operandes[3] = {M, e, n};
+    return lancerFutur(pool, OPERATION_EXPMOD, operandes, 3, rappel, contexte);
+}
+
+/**
+ * \brief Lance la division euclidienne A = q * B + r sur le pool sans attendre
+ * \return Le futur (quotient: resultatFutur, reste: son second paramètre)
+ */
+Futur *lancerDivisionEuclidienne(PoolThreads *pool, BigBinary A, BigBinary B,
+                                 RappelFutur rappel, void *contexte) {
+    BigBinary operandes[2] = {A, B};
+    return lancerFutur(pool, OPERATION_DIVISION, operandes, 2, rappel, contexte);
+}
+
+/**
+ * \brief État courant du futur, sans attendre
+ */
+EtatFutur etatFutur(const Futur *futur) {
+    return (EtatFutur)__atomic_load_n(&futur->etat, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * \brief Attend la fin du futur (terminé ou annulé)
+ * \param futur Futur à attendre
+ * \param delaiMs Délai maximal en millisecondes (négatif = sans limite)
+ * \return true si le futur est fini, false si le délai a expiré
+ *
+ * À ne pas appeler depuis un thread du pool qui doit calculer ce futur.
+ */
+bool attendreFutur(Futur *futur, long delaiMs) {
+    pthread_mutex_lock(&futur->verrou);
+    if (delaiMs < 0) {
+        while (!futurFini(futur)) pthread_cond_wait(&futur->fini, &futur->verrou);
+    } else {
+        struct timespec limite;
+        clock_gettime(CLOCK_REALTIME, &limite);
+        limite.tv_sec += delaiMs / 1000;
+        limite.tv_nsec += (delaiMs % 1000) * 1000000L;
+        if (limite.tv_nsec >= 1000000000L) {
+            limite.tv_sec++;
+            limite.tv_nsec -= 1000000000L;
+        }
+        while (!futurFini(futur)) {
+            if (pthread_cond_timedwait(&futur->fini, &futur->verrou, &limite) == ETIMEDOUT) break;
+        }
+    }
+    bool fini = futurFini(futur);
+    pthread_mutex_unlock(&futur->verrou);
+    return fini;
+}
+
+/**
+ * \brief Annule un futur encore en file
+ * \return true si le calcul n'avait pas commencé (il n'aura jamais lieu),
+ *         false s'il est en cours ou déjà fini
+ *
+ * Le rappel n'est pas appelé pour un futur annulé; ceux qui l'attendent
+ * (attendreFutur, descripteur) sont réveillés.
+ */
+bool annulerFutur(Futur *futur) {
+    int attendu = FUTUR_EN_FILE;
+    if (!__atomic_compare_exchange_n(&futur->etat, &attendu, FUTUR_ANNULE, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    for (int i = 0; i < 3; ++i) libereBigBinary(&futur->operandes[i]);
+    finirFutur(futur, FUTUR_ANNULE);
+    return true;
+}
+
+/**
+ * \brief Descripteur (eventfd) qui devient lisible quand le futur est fini
+ * \return Descripteur à surveiller (poll, epoll...), valide jusqu'à
+ *         libererFutur; -1 si le système ne le permet pas
+ *
+ * Créé à la première demande; signalé aussitôt si le futur est déjà fini.
+ */
+int descripteurFutur(Futur *futur) {
+#if defined(__linux__)
+    pthread_mutex_lock(&futur->verrou);
+    if (futur->evenement < 0) {
+        futur->evenement = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (futur->evenement >= 0 && futurFini(futur)) signalerEvenement(futur->evenement);
+    }
+    int descripteur = futur->evenement;
+    pthread_mutex_unlock(&futur->verrou);
+    return descripteur;
+#else
+    (void)futur;
+    return -1;
+#endif
+}
+
+/**
+ * \brief Remet le résultat d'un futur terminé à l'appelant, sans copie
+ * \param futur Futur dans l'état FUTUR_TERMINE
+ * \param reste Reçoit le reste d'une division (zéro pour ExpMod), ou NULL
+ * \return Le résultat (quotient d'une division), à libérer par l'appelant;
+ *         zéro si le futur n'est pas terminé ou si le résultat a déjà été pris
+ */
+BigBinary resultatFutur(Futur *futur, BigBinary *reste) {
+    if (etatFutur(futur) != FUTUR_TERMINE) {
+        if (reste != NULL) *reste = creerZero();
+        return creerZero();
+    }
+    BigBinary resultat = futur->resultat;
+    memset(&futur->resultat, 0, sizeof(BigBinary));
+    if (reste != NULL) {
+        *reste = (futur->operation == OPERATION_DIVISION) ? futur->reste : creerZero();
+        memset(&futur->reste, 0, sizeof(BigBinary));
+    }
+    return resultat.Tdigits != NULL ? resultat : creerZero();
+}
+
+/**
+ * \brief Libère un futur (un calcul en cours se termine, puis la mémoire est rendue)
+ *
+ * Pour abandonner un calcul encore en file, appeler annulerFutur avant.
+ */
+void libererFutur(Futur *futur) {
+    if (futur != NULL) relacherFutur(futur);
+}
+
+// ============================================================================
+// ========= AJOUT: EXPONENTIATION PARALLÈLE D'UN TRÈS GRAND EXPOSANT =========
+// ============================================================================
+
+/*
+ * L'exposant est découpé en T tranches de c bits (T = nombre de threads):
+ *   e = somme des e_j * 2^(j*c)   donc   M^e = produit des (M^(2^(j*c)))^(e_j)
+ * Avec les puissances B_j = M^(2^(j*c)) mod n connues, les T
+ * exponentiations B_j^(e_j) (c bits chacune) sont indépendantes: la
+ * latence passe de L bits à L / T bits, plus T - 1 produits modulaires.
+ *
+ * Calculer les B_j demande une chaîne de L carrés qui, elle, ne se
+ * parallélise pas: precalculerPuissancesBase la paie une fois pour une
+ * base et un module réutilisés, et seules les exponentiations suivantes
+ * (ExpModPrecalcule) gagnent le facteur T. Pour un calcul isolé, la
+ * chaîne coûte déjà autant qu'ExpMod lui-même: il n'y a rien à gagner.
+ */
+
+struct PuissancesBase {
+    BigBinary base;          // M, pour les exposants trop longs
+    BigBinary module;
+    int nbTranches;
+    int bitsTranche;
+    BigBinary *puissances;   // puissances[j] = M^(2^(j * bitsTranche)) mod n
+};
+
+typedef struct {
+    const PuissancesBase *puissances;
+    BigBinary exposant;
+    BigBinary *partiels;     // partiels[j] = B_j^(e_j) mod n
+} ExpModTranches;
+
+/**
+ * \brief Tranche j de l'exposant: bits [j*c, (j+1)*c) de |e|, en vue (sans copie)
+ */
+static VueBigBinary trancheExposant(BigBinary e, int j, int c) {
+    return vueBitsBas(vueBitsHauts(e, j * c), c);
+}
+
+/**
+ * \brief 2^k (exposant d'une chaîne de k carrés)
+ */
+static BigBinary puissanceDeDeux(int k) {
+    BigBinary p = creerZero();
+    metBit(&p, k);
+    return p;
+}
+
+/**
+ * \brief Sous-tâche: partiels[j] = B_j^(e_j) mod n
+ */
+static void tacheTrancheExposant(int j, void *contexteTache) {
+    ExpModTranches *calcul = contexteTache;
+    const PuissancesBase *p = calcul->puissances;
+
+    BigBinary partiel = ExpMod(p->puissances[j], trancheExposant(calcul->exposant, j, p->bitsTranche),
+                               p->module);
+    Travailleur *t = travailleurCourant;
+    calcul->partiels[j] = (t != NULL) ? exporterResultat(partiel) : partiel;
+}
+
+/**
+ * \brief Produit modulaire des résultats partiels (libérés au passage)
+ */
+static BigBinary combinerPartiels(BigBinary *partiels, int nb, BigBinary n) {
+    BigBinary resultat = partiels[0];
+    for (int j = 1; j < nb; ++j) {
+        BigBinary produit = multiplicationMod(resultat, partiels[j], n);
+        libereBigBinary(&resultat);
+        libereBigBinary(&partiels[j]);
+        resultat = produit;
+    }
+    return resultat;
+}
+
+/**
+ * \brief Précalcule les puissances de M qui découpent un exposant entre les threads
+ * \param pool Pool de threads (une tranche par thread)
+ * \param M Base
+ * \param n Module (> 0)
+ * \param bitsMax Taille maximale des exposants qui seront passés à ExpModPrecalcule
+ * \return Table à libérer avec liberePuissancesBase, NULL en cas d'échec
+ *
+ * Coût: bitsMax carrés modulaires, en séquence. À amortir sur plusieurs
+ * exponentiations de la même base.
+ */
+PuissancesBase *precalculerPuissancesBase(PoolThreads *pool, BigBinary M, BigBinary n, int bitsMax) {
+    PuissancesBase *p = calloc(1, sizeof(PuissancesBase));
+    if (p == NULL) return NULL;
+
+    p->nbTranches = nombreThreadsPool(pool);
+    if (bitsMax < 1) bitsMax = 1;
+    p->bitsTranche = (bitsMax + p->nbTranches - 1) / p->nbTranches;
+    p->puissances = calloc((size_t)p->nbTranches, sizeof(BigBinary));
+    if (p->puissances == NULL) {
+        free(p);
+        return NULL;
+    }
+    p->base = copieBigBinary(M);
+    p->module = copieBigBinary(n);
+
+    // Base négative ou module non positif: ExpModPrecalcule revient à ExpMod
+    if (M.Signe < 0 || n.Signe <= 0) {
+        p->nbTranches = 0;
+        return p;
+    }
+
+    BigBinary pas = puissanceDeDeux(p->bitsTranche);
+    p->puissances[0] = ExpModInt(M, 1, n);
+    for (int j = 1; j < p->nbTranches; ++j) {
+        p->puissances[j] = ExpMod(p->puissances[j - 1], pas, n);
+    }
+    libereBigBinary(&pas);
+    return p;
+}
+
+/**
+ * \brief M^e mod n avec les puissances précalculées, une tranche de e par thread
+ * \param pool Pool de threads
+ * \param puissances Table de precalculerPuissancesBase (lue seulement)
+ * \param e Exposant (0 < e < 2^bitsMax, sinon ExpMod séquentiel)
+ * \return Nouveau BigBinary égal à ExpMod(M, e, n)
+ */
+BigBinary ExpModPrecalcule(PoolThreads *pool, const PuissancesBase *puissances, BigBinary e) {
+    const PuissancesBase *p = puissances;
+    if (p->nbTranches == 0 || e.Signe <= 0 || e.Taille > p->nbTranches * p->bitsTranche) {
+        return ExpMod(p->base, e, p->module);
+    }
+
+    BigBinary *partiels = calloc((size_t)p->nbTranches, sizeof(BigBinary));
+    if (partiels == NULL) return ExpMod(p->base, e, p->module);
+
+    ExpModTranches calcul = {p, e, partiels};
+    executeurPool(pool)->executer(p->nbTranches, tacheTrancheExposant, &calcul, pool);
+    BigBinary resultat = combinerPartiels(partiels, p->nbTranches, p->module);
+
+    free(partiels);
+    return resultat;
+}
+
+/**
+ * \brief Libère une table de puissances précalculées
+ */
+void liberePuissancesBase(PuissancesBase *puissances) {
+    if (puissances == NULL) return;
+    for (int j = 0; j < puissances->nbTranches; ++j) libereBigBinary(&puissances->puissances[j]);
+    libereBigBinary(&puissances->base);
+    libereBigBinary(&puissances->module);
+    free(puissances->puissances);
+    free(puissances);
+}
+
+// ============================================================================
+// ======= AJOUT: PGCD PAR LOTS (ARBRE DE PRODUITS ET ARBRE DE RESTES) ========
+// ============================================================================
+
+/*
+ * PGCD par lots de Bernstein: pour chaque module n_i, g_i = PGCD(n_i, P / n_i)
+ * avec P le produit de tous les modules, en O(k log^2 k) au lieu des k^2
+ * PGCD deux à deux:
+ * - arbre de produits: niveau 0 = modules, chaque nœud = produit de ses
+ *   deux fils (un fils unique remonte tel quel), racine = P
+ * - arbre de restes: reste(racine) = P, reste(v) = reste(parent) mod v^2,
+ *   jusqu'aux feuilles r_i = P mod n_i^2
+ * - g_i = PGCD(r_i / n_i, n_i): n_i partage un facteur avec un autre
+ *   module exactement quand g_i > 1
+ * Chaque niveau est calculé en parallèle (tranches de nœuds réparties sur
+ * le pool); près de la racine, les quelques produits énormes se
+ * parallélisent eux-mêmes par Karatsuba (executeurPool).
+ *
+ * Mémoire: chaque niveau pèse à peu près la taille totale des modules.
+ * Au-delà de memoireMax, les niveaux déjà construits de l'arbre de
+ * produits sont écrits sur disque (format compact de
+ * ecrireFichierBigBinary) puis relus un par un pendant la descente: la
+ * mémoire reste bornée par trois niveaux environ.
+ */
+
+#define TRANCHES_ARBRE_PAR_THREAD 16
+
+typedef enum {
+    ETAPE_PRODUITS,  // resultats[i] = niveau[2i] * niveau[2i + 1]
+    ETAPE_RESTES,    // resultats[i] = restes[i / 2] mod niveau[i]^2
+    ETAPE_FACTEURS   // resultats[i] = PGCD(restes[i] / niveau[i], niveau[i])
+} EtapeArbre;
+
+typedef struct {
+    EtapeArbre etape;
+    const BigBinary *niveau;
+    size_t nbNiveau;
+    const BigBinary *restes;
+    BigBinary *resultats;
+    size_t nb;               // Nombre de résultats
+    size_t parTache;         // Résultats par sous-tâche
+} CalculArbre;
+
+// Niveau de l'arbre de produits, en mémoire ou sur disque
+typedef struct {
+    BigBinary *nombres;      // NULL si le niveau a été écrit sur disque
+    size_t nb;
+    char *chemin;            // Fichier du niveau (NULL s'il n'a jamais été écrit)
+} NiveauArbre;
+
+static size_t octetsNombres(const BigBinary *nombres, size_t nb) {
+    size_t octets = 0;
+    for (size_t i = 0; i < nb; ++i) octets += (size_t)nombres[i].Taille * sizeof(int);
+    return octets;
+}
+
+static void libereNombres(BigBinary *nombres, size_t nb) {
+    if (nombres == NULL) return;
+    for (size_t i = 0; i < nb; ++i) libereBigBinary(&nombres[i]);
+    free(nombres);
+}
+
+/**
+ * \brief Sous-tâche: une tranche de nœuds d'un niveau
+ *
+ * Calcul sur l'allocateur global (comme les futurs): les nœuds survivent
+ * à la tâche et sont libérés par un autre thread, sans copie.
+ */
+static void tacheArbre(int tache, void *contexteTache) {
+    CalculArbre *calcul = contexteTache;
+    size_t debut = (size_t)tache * calcul->parTache;
+    size_t fin = debut + calcul->parTache < calcul->nb ? debut + calcul->parTache : calcul->nb;
+
+    // L'allocateur trouvé est remis à la fin: la tranche a pu être volée
+    // par une tâche qui l'avait elle-même changé
+    const AllocateurBigBinary *precedent = allocateurThreadCourant();
+    definirAllocateurThread(NULL);
+
+    for (size_t i = debut; i < fin; ++i) {
+        const BigBinary *v = calcul->niveau;
+        switch (calcul->etape) {
+            case ETAPE_PRODUITS:
+                calcul->resultats[i] = (2 * i + 1 < calcul->nbNiveau)
+                                           ? MultiplicationEgyptienne(v[2 * i], v[2 * i + 1])
+                                           : copieBigBinary(v[2 * i]);
+                break;
+            case ETAPE_RESTES: {
+                BigBinary carre = MultiplicationEgyptienne(v[i], v[i]);
+                calcul->resultats[i] = Modulo(calcul->restes[i / 2], carre);
+                libereBigBinary(&carre);
+                break;
+            }
+            case ETAPE_FACTEURS: {
+                DivisionResult division = DivisionEuclidienne(calcul->restes[i], v[i]);
+                calcul->resultats[i] = PGCD(division.quotient, v[i]);
+                libereBigBinary(&division.quotient);
+                libereBigBinary(&division.reste);
+                break;
+            }
+        }
+    }
+
+    definirAllocateurThread(precedent);
+}
+
+/**
+ * \brief Calcule les nb résultats d'une étape en parallèle
+ * \return Tableau de résultats (NULL si la mémoire manque)
+ */
+static BigBinary *executerEtape(PoolThreads *pool, EtapeArbre etape, const BigBinary *niveau,
+                                size_t nbNiveau, const BigBinary *restes, size_t nb) {
+    BigBinary *resultats = calloc(nb, sizeof(BigBinary));
+    if (resultats == NULL) return NULL;
+
+    size_t nbTaches = (size_t)pool->nbThreads * TRANCHES_ARBRE_PAR_THREAD;
+    if (nbTaches > nb) nbTaches = nb;
+    CalculArbre calcul = {etape, niveau, nbNiveau, restes, resultats, nb, (nb + nbTaches - 1) / nbTaches};
+    nbTaches = (nb + calcul.parTache - 1) / calcul.parTache;
+
+    pool->executeur.executer((int)nbTaches, tacheArbre, &calcul, pool);
+    return resultats;
+}
+
+/**
+ * \brief Écrit un niveau sur disque et libère sa mémoire
+ * \return false si l'écriture a échoué (le niveau reste alors en mémoire)
+ */
+static bool deposerNiveau(NiveauArbre *niveau, const char *repertoire) {
+    size_t longueur = strlen(repertoire) + 64;
+    char *chemin = malloc(longueur);
+    if (chemin == NULL) return false;
+    // Nom unique même pour plusieurs appels simultanés dans le processus
+    snprintf(chemin, longueur, "%s/pgcd-lots-%ld-%p.bbin", repertoire, (long)getpid(), (void *)niveau);
+
+    if (!ecrireFichierBigBinary(chemin, niveau->nombres, niveau->nb, true)) {
+        remove(chemin);
+        free(chemin);
+        return false;
+    }
+    libereNombres(niveau->nombres, niveau->nb);
+    niveau->nombres = NULL;
+    niveau->chemin = chemin;
+    return true;
+}
+
+/**
+ * \brief PGCD de chaque module avec le produit de tous les autres (PGCD par lots)
+ * \param pool Pool de threads
+ * \param modules Modules RSA (> 0)
+ * \param nb Nombre de modules
+ * \param facteurs Reçoit g_i = PGCD(n_i, produit des autres) pour chaque module (à libérer)
+ * \param repertoireTemp Répertoire où écrire les niveaux de l'arbre (NULL = tout en mémoire)
+ * \param memoireMax Mémoire des niveaux au-delà de laquelle ils vont sur disque (0 = sans limite)
+ * \return Nombre de modules faibles (g_i > 1), -1 en cas d'erreur
+ *
+ * g_i = n_i signale un module dont les deux facteurs sont partagés (ou un
+ * doublon): le facteur commun se retrouve alors par PGCD deux à deux
+ * parmi les seuls modules faibles.
+ */
+long PGCDParLots(PoolThreads *pool, const BigBinary *modules, size_t nb, BigBinary *facteurs,
+                 const char *repertoireTemp, size_t memoireMax) {
+    if (nb == 0) return 0;
+    for (size_t i = 0; i < nb; ++i) {
+        if (modules[i].Signe <= 0) return -1;
+    }
+
+    // Profondeur de l'arbre: niveau 0 = modules, dernier niveau = racine
+    int hauteur = 1;
+    for (size_t n = nb; n > 1; n = (n + 1) / 2) hauteur++;
+    NiveauArbre *niveaux = calloc((size_t)hauteur, sizeof(NiveauArbre));
+    if (niveaux == NULL) return -1;
+    niveaux[0].nombres = (BigBinary *)modules;  // Jamais libéré ni déposé
+    niveaux[0].nb = nb;
+
+    const ExecuteurBigBinary *precedent = executeurCourant();
+    definirExecuteurThread(&pool->executeur);
+    long nbFaibles = -1;
+    BigBinary *restes = NULL;
+    size_t nbRestes = 0;
+
+    // === ARBRE DE PRODUITS ===
+    size_t memoire = 0;
+    for (int k = 1; k < hauteur; ++k) {
+        NiveauArbre *fils = &niveaux[k - 1];
+        niveaux[k].nb = (fils->nb + 1) / 2;
+        niveaux[k].nombres = executerEtape(pool, ETAPE_PRODUITS, fils->nombres, fils->nb, NULL,
+                                           niveaux[k].nb);
+        if (niveaux[k].nombres == NULL) goto fin;
+
+        memoire += octetsNombres(niveaux[k].nombres, niveaux[k].nb);
+        if (repertoireTemp != NULL && memoireMax > 0 && memoire > memoireMax && k - 1 >= 1 &&
+            k + 1 < hauteur) {
+            size_t octets = octetsNombres(fils->nombres, fils->nb);
+            if (deposerNiveau(fils, repertoireTemp)) memoire -= octets;
+        }
+    }
+
+    // === ARBRE DE RESTES: reste(racine) = P ===
+    nbRestes = 1;
+    restes = calloc(1, sizeof(BigBinary));
+    if (restes == NULL) goto fin;
+    restes[0] = copieBigBinary(niveaux[hauteur - 1].nombres[0]);
+
+    for (int k = hauteur - 2; k >= 0; --k) {
+        NiveauArbre *niveau = &niveaux[k];
+        FichierBigBinary fichier = {0};
+        const BigBinary *noeuds = niveau->nombres;
+        if (noeuds == NULL) {
+            if (!ouvrirFichierBigBinary(niveau->chemin, &fichier) || fichier.nb != niveau->nb) goto fin;
+            noeuds = fichier.nombres;
+        }
+
+        BigBinary *enfants = executerEtape(pool, ETAPE_RESTES, noeuds, niveau->nb, restes, niveau->nb);
+        if (niveau->chemin != NULL) fermerFichierBigBinary(&fichier);
+        if (enfants == NULL) goto fin;
+
+        libereNombres(restes, nbRestes);
+        restes = enfants;
+        nbRestes = niveau->nb;
+
+        // Le niveau du dessus ne sert plus
+        if (k + 1 < hauteur) {
+            libereNombres(niveaux[k + 1].nombres, niveaux[k + 1].nb);
+            niveaux[k + 1].nombres = NULL;
+        }
+    }
+
+    // === FEUILLES: g_i = PGCD(r_i / n_i, n_i) ===
+    BigBinary *g = executerEtape(pool, ETAPE_FACTEURS, modules, nb, restes, nb);
+    if (g == NULL) goto fin;
+    nbFaibles = 0;
+    for (size_t i = 0; i < nb; ++i) {
+        facteurs[i] = g[i];
+        if (!(g[i].Taille == 1 && g[i].Tdigits[0] == 1)) nbFaibles++;
+    }
+    free(g);
+
+fin:
+    libereNombres(restes, nbRestes);
+    for (int k = 1; k < hauteur; ++k) {
+        libereNombres(niveaux[k].nombres, niveaux[k].nb);
+        if (niveaux[k].chemin != NULL) {
+            remove(niveaux[k].chemin);
+            free(niveaux[k].chemin);
+        }
+    }
+    free(niveaux);
+    definirExecuteurThread(precedent);
+    return nbFaibles;
+}
+
+/**
+ * \brief Audit d'un fichier de modules RSA: écrit les modules qui partagent un facteur
+ * \param pool Pool de threads
+ * \param entree Fichier de modules (format ecrireFichierBigBinary)
+ * \param sortie Fichier créé avec, pour chaque module faible, le module puis
+ *               le facteur trouvé (2 entiers par module, format compact)
+ * \param repertoireTemp Répertoire pour les niveaux de l'arbre (NULL = tout en mémoire)
+ * \param memoireMax Voir PGCDParLots
+ * \return Nombre de modules faibles, -1 en cas d'erreur
+ */
+long auditerModulesFichier(PoolThreads *pool, const char *entree, const char *sortie,
+                           const char *repertoireTemp, size_t memoireMax) {
+    FichierBigBinary fichier;
+    if (!ouvrirFichierBigBinary(entree, &fichier)) return -1;
+
+    BigBinary *facteurs = calloc(fichier.nb > 0 ? fichier.nb : 1, sizeof(BigBinary));
+    long nbFaibles = -1;
+    if (facteurs != NULL) {
+        nbFaibles = PGCDParLots(pool, fichier.nombres, fichier.nb, facteurs, repertoireTemp, memoireMax);
+    }
+
+    if (nbFaibles >= 0) {
+        // Paires (module, facteur): vues sur les entrées, aucune copie
+        BigBinary *paires = malloc(sizeof(BigBinary) * (size_t)(2 * nbFaibles + 1));
+        size_t nbPaires = 0;
+        if (paires == NULL) {
+            nbFaibles = -1;
+        } else {
+            for (size_t i = 0; i < fichier.nb; ++i) {
+                if (facteurs[i].Taille == 1 && facteurs[i].Tdigits[0] == 1) continue;
+                paires[nbPaires++] = fichier.nombres[i];
+                paires[nbPaires++] = facteurs[i];
+            }
+            if (!ecrireFichierBigBinary(sortie, paires, nbPaires, true)) nbFaibles = -1;
+            free(paires);
+        }
+        for (size_t i = 0; i < fichier.nb; ++i) libereBigBinary(&facteurs[i]);
+    }
+
+    free(facteurs);
+    fermerFichierBigBinary(&fichier);
+    return nbFaibles;
+}
@@ -0,0 +1,139 @@
+#ifndef PARALLELE_H
+#define PARALLELE_H
+
+#include "bigbinary.h"
+
+// ========== AJOUT: POOL DE THREADS ET TRAITEMENTS PAR LOTS ==========
+
+// Pool de threads POSIX réutilisable (structure opaque)
+typedef struct PoolThreads PoolThreads;
+
+// Tâche appelée pour chaque indice d'un lot (travailleur = numéro du thread, de 0 à n-1)
+typedef void (*TacheIndice)(int indice, int travailleur, void *contexte);
+
+// Crée un pool de nbThreads threads (0 = nombre de cœurs disponibles)
+PoolThreads *creerPoolThreads(int nbThreads);
+
+// Arrête les threads et libère le pool
+void detruirePoolThreads(PoolThreads *pool);
+
+// Nombre de threads du pool
+int nombreThreadsPool(const PoolThreads *pool);
+
+// Exécute tache(i) pour i = 0..nb-1 sur les threads du pool, rend la main quand tout est fini
+void executerLot(PoolThreads *pool, int nb, TacheIndice tache, void *contexte);
+
+// Exécuteur de sous-calculs sur le pool (vol de tâches), à installer avec definirExecuteurThread
+const ExecuteurBigBinary *executeurPool(PoolThreads *pool);
+
+// ========== AJOUT: RSA PAR LOTS ==========
+
+// Chiffrement d'un lot : chiffres[i] = messages[i]^e mod n (résultats dans l'ordre)
+void RSA_encryptLot(PoolThreads *pool, const BigBinary *messages, BigBinary *chiffres, int nb,
+                    BigBinary e, BigBinary n);
+
+// Déchiffrement d'un lot : messages[i] = chiffres[i]^d mod n (résultats dans l'ordre)
+void RSA_decryptLot(PoolThreads *pool, const BigBinary *chiffres, BigBinary *messages, int nb,
+                    BigBinary d, BigBinary n);
+
+// ========== AJOUT: MULTIPLICATION PARALLÈLE DES TRÈS GRANDS NOMBRES ==========
+
+// A * B avec les sous-produits de Karatsuba répartis sur le pool (au-delà de 128 Kbits)
+BigBinary MultiplicationParallele(PoolThreads *pool, BigBinary A, BigBinary B);
+
+// ========== AJOUT: TRAVAUX EN MASSE (PGCD, MODULO) PAR VOL DE TÂCHES ==========
+
+typedef enum {
+    TRAVAIL_PGCD,    // resultat = PGCD(a, b)
+    TRAVAIL_MODULO   // resultat = a mod b
+} TypeTravail;
+
+// Descripteur d'une opération (a et b lus seulement, resultat rempli par executerTravaux)
+typedef struct {
+    TypeTravail type;
+    BigBinary a;
+    BigBinary b;
+    BigBinary resultat;  // À libérer par l'appelant
+} Travail;
+
+// Bilan d'un thread du pool pour un appel à executerTravaux
+typedef struct {
+    long travaux;            // Opérations calculées par ce thread
+    long tranchesVolees;     // Tranches prises dans la file d'un autre thread
+    double secondesActives;  // Temps passé à calculer
+    double utilisation;      // secondesActives / durée de l'appel (0 à 1)
+} StatistiquesTravailleur;
+
+// Calcule tous les travaux sur le pool et rend la main quand tout est fini;
+// stats (nombreThreadsPool(pool) entrées, ou NULL) reçoit le bilan de chaque thread
+void executerTravaux(PoolThreads *pool, Travail *travaux, int nb, StatistiquesTravailleur *stats);
+
+// ========== AJOUT: CALCULS ASYNCHRONES (FUTURS) ==========
+
+// Opération lancée sur le pool dont l'appelant récupère le résultat plus tard
+typedef struct Futur Futur;
+
+typedef enum {
+    FUTUR_EN_FILE,   // Pas encore commencé (annulable)
+    FUTUR_EN_COURS,
+    FUTUR_TERMINE,   // Résultat disponible
+    FUTUR_ANNULE
+} EtatFutur;
+
+// Appelée sur un thread du pool quand le résultat est prêt
+typedef void (*RappelFutur)(Futur *futur, void *contexte);
+
+// Lance M^e mod n et rend la main aussitôt (rappel peut être NULL)
+Futur *lancerExpMod(PoolThreads *pool, BigBinary M, BigBinary e, BigBinary n,
+                    RappelFutur rappel, void *contexte);
+
+// Lance DivisionEuclidienne(A, B) et rend la main aussitôt (rappel peut être NULL)
+Futur *lancerDivisionEuclidienne(PoolThreads *pool, BigBinary A, BigBinary B,
+                                 RappelFutur rappel, void *contexte);
+
+// État courant, sans attendre
+EtatFutur etatFutur(const Futur *futur);
+
+// Attend la fin (delaiMs < 0: sans limite); false si le délai a expiré
+bool attendreFutur(Futur *futur, long delaiMs);
+
+// Annule un futur encore en file; false s'il a déjà commencé
+bool annulerFutur(Futur *futur);
+
+// eventfd lisible à la fin du futur (-1 si indisponible sur ce système)
+int descripteurFutur(Futur *futur);
+
+// Remet le résultat (et le reste d'une division) sans copie; à libérer par l'appelant
+BigBinary resultatFutur(Futur *futur, BigBinary *reste);
+
+// Libère le futur
+void libererFutur(Futur *futur);
+
+// ========== AJOUT: EXPONENTIATION PARALLÈLE D'UN TRÈS GRAND EXPOSANT ==========
+
+// Puissances M^(2^(j*c)) mod n qui découpent l'exposant en une tranche par thread
+typedef struct PuissancesBase PuissancesBase;
+
+// Précalcule la table pour des exposants d'au plus bitsMax bits (bitsMax carrés séquentiels)
+PuissancesBase *precalculerPuissancesBase(PoolThreads *pool, BigBinary M, BigBinary n, int bitsMax);
+
+// M^e mod n, les tranches de e élevées en parallèle puis multipliées entre elles
+BigBinary ExpModPrecalcule(PoolThreads *pool, const PuissancesBase *puissances, BigBinary e);
+
+// Libère la table
+void liberePuissancesBase(PuissancesBase *puissances);
+
+// ========== AJOUT: PGCD PAR LOTS (AUDIT DE MODULES RSA) ==========
+
+// facteurs[i] = PGCD(modules[i], produit des autres) par arbres de produits et de restes;
+// au-delà de memoireMax octets, les niveaux de l'arbre passent par repertoireTemp (NULL = jamais).
+// Renvoie le nombre de modules faibles (facteur > 1), -1 en cas d'erreur
+long PGCDParLots(PoolThreads *pool, const BigBinary *modules, size_t nb, BigBinary *facteurs,
+                 const char *repertoireTemp, size_t memoireMax);
+
+// Lit les modules d'un fichier (ecrireFichierBigBinary) et écrit dans sortie les paires
+// (module faible, facteur trouvé); renvoie le nombre de modules faibles, -1 en cas d'erreur
+long auditerModulesFichier(PoolThreads *pool, const char *entree, const char *sortie,
+                           const char *repertoireTemp, size_t memoireMax);
+
+#endif // PARALLELE_H
@@ -1,4 +1,18 @@
+#define _POSIX_C_SOURCE 200809L
 #include "bigbinary.h"
+#include "parallele.h"
+#include <limits.h>
+#include <pthread.h>
+#if defined(__linux__)
+#include <poll.h>
+#endif
+#include <signal.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+// Nombre de vérifications échouées (code de retour du programme)
+static int nb_echecs = 0;
 
 void afficher_test_separateur(const char* nom_test) {
     printf("\n");
@@ -7,6 +21,50 @@ void afficher_test_separateur(const char* nom_test) {
     printf("========================================\n");
 }
 
+// Affiche le résultat d'une vérification et compte les échecs
+void verifier(int condition, const char* description) {
+    printf("%s %s\n", condition ? "✓" : "✗", description);
+    if (!condition) nb_echecs++;
+}
+
+// Vérifie que obtenu vaut la valeur décimale attendue, puis libère obtenu
+void verifier_valeur(BigBinary obtenu, const char* attendu, const char* description) {
+    char* texte = BigBinaryVersChaineDecimale(obtenu);
+    int ok = texte != NULL && strcmp(texte, attendu) == 0;
+    if (!ok) printf("  obtenu %s, attendu %s\n", texte ? texte : "(null)", attendu);
+    verifier(ok, description);
+    free(texte);
+    libereBigBinary(&obtenu);
+}
+
+// Raccourci: BigBinary depuis une chaîne décimale
+BigBinary dec(const char* chaine) {
+    return creerBigBinaryDepuisChaineDecimale(chaine);
+}
+
+// Contenu complet d'un fichier (à libérer avec free), NULL en cas d'erreur
+unsigned char* lire_octets(const char* chemin, long* taille) {
+    FILE* f = fopen(chemin, "rb");
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    *taille = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char* octets = malloc((size_t)*taille);
+    if (octets != NULL && fread(octets, 1, (size_t)*taille, f) != (size_t)*taille) {
+        free(octets);
+        octets = NULL;
+    }
+    fclose(f);
+    return octets;
+}
+
+void ecrire_octets(const char* chemin, const unsigned char* octets, long taille) {
+    FILE* f = fopen(chemin, "wb");
+    if (f == NULL) return;
+    fwrite(octets, 1, (size_t)taille, f);
+    fclose(f);
+}
+
 void tester_multiplication_egyptienne() {
     afficher_test_separateur("TEST: MULTIPLICATION ÉGYPTIENNE");
     
@@ -216,6 +274,1622 @@ void tester_rsa_exemple_jouet() {
     libereBigBinary(&M_dechiffre);
 }
 
+void tester_decalages() {
+    afficher_test_separateur("TEST: DÉCALAGES DE k BITS (PGCD, MODULO, DIVISION)");
+
+    // A = 3^200, B = 7^90 + 12345
+    BigBinary A = dec("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    BigBinary B = dec("11450477594321044359340126713545146077054004823284978858214566372120240039594");
+
+    verifier_valeur(decaleGauche(A, 131),
+                    "723070054575955884960245995984194760151930655009486880408773441836509134518670230382477996785708413607569123277313112640385158530203648",
+                    "3^200 << 131");
+    verifier_valeur(decaleDroite(A, 67), "1799870398636025204067182234339325754178701793953510951717753442955869615556",
+                    "3^200 >> 67");
+    verifier_valeur(decaleDroite(A, 5000), "0", "décalage à droite au-delà de la taille = 0");
+
+    BigBinary C = copieBigBinary(A);
+    decaleGaucheEnPlace(&C, 64);
+    decaleDroiteEnPlace(&C, 64);
+    verifier(Egal(C, A), "(A << 64) >> 64 = A, en place");
+    libereBigBinary(&C);
+
+    verifier_valeur(Modulo(A, B), "1070899271811779049303735016967845875860090566313191075423362162117308462849",
+                    "3^200 mod (7^90 + 12345)");
+    DivisionResult d = DivisionEuclidienne(A, B);
+    verifier_valeur(d.quotient, "23196760719186782608", "quotient de 3^200 / (7^90 + 12345)");
+    libereBigBinary(&d.reste);
+
+    // PGCD avec de nombreux facteurs 2 communs (supprimés par décalages de k bits)
+    BigBinary X = dec("3449398145734039958996760570902425491221862145212338978402187165007986221915049658475982566273144546942245965517553664");
+    BigBinary Y = dec("138489265843990028627774023712485373139298845225008045651177681589723076773628345931792384");
+    verifier_valeur(PGCD(X, Y), "24189255811072", "PGCD(3^200 * 2^70 * 11, B * 2^40 * 11) = 2^40 * 11 * PGCD(A, B)");
+
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+    libereBigBinary(&X);
+    libereBigBinary(&Y);
+}
+
+void tester_operations_bit_a_bit() {
+    afficher_test_separateur("TEST: OPÉRATIONS BIT À BIT");
+
+    BigBinary a = dec("437"), b = dec("11");  // 110110101 et 1011
+    verifier_valeur(EtBinaire(a, b), "1", "437 & 11 = 1");
+    verifier_valeur(OuBinaire(a, b), "447", "437 | 11 = 447");
+    verifier_valeur(OuExclusif(a, b), "446", "437 ^ 11 = 446");
+    verifier_valeur(EtNonBinaire(a, b), "436", "437 & ~11 = 436");
+    verifier_valeur(NonBinaire(a), "74", "~437 sur 9 bits = 74");
+    verifier_valeur(OuExclusif(a, a), "0", "a ^ a = 0");
+    verifier(testeBit(a, 0) && !testeBit(a, 1) && testeBit(a, 8) && !testeBit(a, 500), "testeBit");
+    verifier(poidsHamming(a) == 6 && longueurBits(a) == 9, "poidsHamming(437) = 6, longueurBits = 9");
+
+    BigBinary c = copieBigBinary(a);
+    metBit(&c, 100);
+    verifier(longueurBits(c) == 101 && testeBit(c, 100), "metBit(100) agrandit le nombre");
+    verifier(longueurBits(a) == 9, "metBit sur une copie ne touche pas l'original");
+    effaceBit(&c, 100);
+    verifier(Egal(c, a), "effaceBit(100) revient au nombre d'origine");
+    libereBigBinary(&c);
+
+    BigBinary zero = dec("0");
+    verifier(longueurBits(zero) == 0 && poidsHamming(zero) == 0, "longueurBits(0) = poidsHamming(0) = 0");
+    BigBinary pair = decaleGauche(a, 70);
+    verifier(compteZerosFinaux(pair) == 70, "compteZerosFinaux(437 * 2^70) = 70");
+
+    // Opérandes de plusieurs mots: A = 3^200, B = 5^100
+    BigBinary A = dec("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    BigBinary B = dec("7888609052210118054117285652827862296732064351090230047702789306640625");
+    verifier_valeur(EtBinaire(A, B), "7766446754906281682913882763075063255126160075729080139878858267599009", "3^200 & 5^100");
+    verifier_valeur(OuBinaire(A, B),
+                    "265613988875874769338781322157941924133069823856797385727374003344996766262452090818315738085617",
+                    "3^200 | 5^100");
+    verifier_valeur(OuExclusif(A, B),
+                    "265613988875874769338781314391495169226788140942914622652310748218836690533371950939457470486608",
+                    "3^200 ^ 5^100");
+    verifier_valeur(EtNonBinaire(A, B),
+                    "265613988875874769338781314269332871922951769739511732899511706612932415172222043115526431444992",
+                    "3^200 & ~5^100");
+    verifier(poidsHamming(A) == 178 && longueurBits(A) == 317, "poidsHamming(3^200) = 178, longueurBits = 317");
+
+    libereBigBinary(&a);
+    libereBigBinary(&b);
+    libereBigBinary(&zero);
+    libereBigBinary(&pair);
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+}
+
+void tester_comparaisons() {
+    afficher_test_separateur("TEST: COMPARAISON TROIS-VOIES");
+
+    BigBinary m5 = dec("-5"), m3 = dec("-3"), p3 = dec("3"), p5 = dec("5"), zero = dec("0");
+    BigBinary grand = dec("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    BigBinary grand2 = dec("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044000");
+
+    verifier(Comparer(p3, p5) == -1 && Comparer(p5, p3) == 1 && Comparer(p3, p3) == 0, "3 < 5, 5 > 3, 3 == 3");
+    verifier(Comparer(m5, p3) == -1 && Comparer(p3, m5) == 1, "-5 < 3");
+    verifier(Comparer(m5, m3) == -1 && Comparer(m3, m5) == 1, "-5 < -3");
+    verifier(Comparer(zero, m3) == 1 && Comparer(zero, p3) == -1 && Comparer(zero, zero) == 0, "-3 < 0 < 3");
+    verifier(ComparerMagnitude(m5, p3) == 1 && ComparerMagnitude(m3, p3) == 0, "|-5| > |3|, |-3| == |3|");
+    verifier(Comparer(grand, grand2) == 1 && Comparer(grand2, grand) == -1, "grands nombres qui ne diffèrent qu'au dernier bit");
+    verifier(Comparer(grand, p5) == 1 && Comparer(p5, grand) == -1, "tailles différentes");
+    verifier(Inferieur(m5, m3) && Superieur(p5, m5) && Egal(p3, p3) && !Egal(p3, m3), "Inferieur, Superieur, Egal");
+
+    libereBigBinary(&m5);
+    libereBigBinary(&m3);
+    libereBigBinary(&p3);
+    libereBigBinary(&p5);
+    libereBigBinary(&zero);
+    libereBigBinary(&grand);
+    libereBigBinary(&grand2);
+}
+
+void tester_operations_natives() {
+    afficher_test_separateur("TEST: OPÉRATIONS AVEC UN ENTIER NATIF (64 BITS)");
+
+    BigBinary A = dec("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    BigBinary mA = dec("-265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    BigBinary p5 = dec("5"), m5 = dec("-5");
+    uint64_t max = UINT64_MAX;
+
+    verifier_valeur(Addition_ui(A, max),
+                    "265613988875874769338781322035779626829233452653394495974574961739092490901320629738458408595616",
+                    "3^200 + (2^64 - 1)");
+    verifier_valeur(Soustraction_ui(A, max),
+                    "265613988875874769338781322035779626829233452653394495974574961739092490901283736250310989492386",
+                    "3^200 - (2^64 - 1)");
+    verifier_valeur(Multiplication_ui(A, max),
+                    "4899713275190397668763875458428706894328636497868110967492055134005676841972938757687019108918505412094032865611615",
+                    "3^200 * (2^64 - 1)");
+    verifier_valeur(Soustraction_ui(p5, 7), "-2", "5 - 7 = -2");
+    verifier_valeur(Addition_ui(m5, 3), "-2", "-5 + 3 = -2");
+    verifier_valeur(Addition_ui(m5, 5), "0", "-5 + 5 = 0");
+    verifier_valeur(Multiplication_ui(m5, 3), "-15", "-5 * 3 = -15");
+    verifier_valeur(Multiplication_ui(A, 0), "0", "A * 0 = 0");
+
+    uint64_t reste = 0;
+    verifier_valeur(DivisionEuclidienne_ui(A, 1000000007, &reste),
+                    "265613987016576860222743300476576523493197788201009978567505111766556708535405223246548",
+                    "3^200 / 1000000007");
+    verifier(reste == 136318165, "3^200 mod 1000000007 = 136318165");
+    verifier(Modulo_ui(A, 97) == 62 && Modulo_ui(mA, 97) == 62, "|±3^200| mod 97 = 62");
+    verifier(Modulo_ui(A, max) == 13784367590845050696ULL, "3^200 mod (2^64 - 1)");
+
+    libereBigBinary(&A);
+    libereBigBinary(&mA);
+    libereBigBinary(&p5);
+    libereBigBinary(&m5);
+}
+
+void tester_diviseurs_prepares() {
+    afficher_test_separateur("TEST: DIVISION PAR UN MOT AVEC INVERSE PRÉCALCULÉ");
+
+    BigBinary A = dec("-265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    uint64_t diviseurs[7] = {1, 2, 3, 97, 1000000007, 9223372036854775808ULL, UINT64_MAX};
+    uint64_t attendus[7] = {0, 1, 0, 62, 136318165, 6627890308811632801ULL, 13784367590845050696ULL};
+
+    DiviseurNatif table[7];
+    for (int i = 0; i < 7; ++i) table[i] = preparerDiviseurNatif(diviseurs[i]);
+
+    int ok_modulo = 1, ok_division = 1;
+    for (int i = 0; i < 7; ++i) {
+        ok_modulo = ok_modulo && Modulo_pre(A, &table[i]) == attendus[i];
+        uint64_t reste_pre = 0, reste_ui = 0;
+        BigBinary q_pre = DivisionEuclidienne_pre(A, &table[i], &reste_pre);
+        BigBinary q_ui = DivisionEuclidienne_ui(A, diviseurs[i], &reste_ui);
+        ok_division = ok_division && Egal(q_pre, q_ui) && q_pre.Signe == q_ui.Signe && reste_pre == reste_ui;
+        libereBigBinary(&q_pre);
+        libereBigBinary(&q_ui);
+    }
+    verifier(ok_modulo, "Modulo_pre: restes connus pour 1, 2, 3, 97, 10^9+7, 2^63, 2^64-1");
+    verifier(ok_division, "DivisionEuclidienne_pre = DivisionEuclidienne_ui (quotient, signe, reste)");
+
+    uint64_t restes[7];
+    ModuloMultiple_pre(A, table, 7, restes);
+    verifier(memcmp(restes, attendus, sizeof(restes)) == 0, "ModuloMultiple_pre: les 7 restes en une passe");
+
+    libereBigBinary(&A);
+}
+
+void tester_conversions_decimales() {
+    afficher_test_separateur("TEST: CONVERSIONS DÉCIMALES DE TAILLE QUELCONQUE");
+
+    BigBinary un = dec("1");
+    verifier_valeur(decaleGauche(un, 1000),
+                    "10715086071862673209484250490600018105614048117055336074437503883703510511249361224931983788156958581275946729175531468251871452856923140435984577574698574803934567774824230985421074605062371141877954182153046474983581941267398767559165543946077062914571196477686542167660429831652624386837205668069376",
+                    "2^1000 en décimal");
+    libereBigBinary(&un);
+
+    // Bornes des blocs de 19 chiffres, signes, zéros de tête et séparateurs
+    const char* entrees[8] = {"9999999999999999999", "10000000000000000000", "-000123", "-0", "+42",
+                              "1 234 567", "0", "-18446744073709551616"};
+    const char* attendus[8] = {"9999999999999999999", "10000000000000000000", "-123", "0", "42",
+                               "1234567", "0", "-18446744073709551616"};
+    int ok = 1;
+    for (int i = 0; i < 8; ++i) {
+        BigBinary nb = dec(entrees[i]);
+        char* texte = BigBinaryVersChaineDecimale(nb);
+        if (strcmp(texte, attendus[i]) != 0) {
+            printf("  \"%s\" -> %s, attendu %s\n", entrees[i], texte, attendus[i]);
+            ok = 0;
+        }
+        free(texte);
+        libereBigBinary(&nb);
+    }
+    verifier(ok, "blocs de 19 chiffres, signes, zéros de tête, séparateurs");
+    verifier_valeur(creerBigBinaryDepuisDecimal(LLONG_MIN), "-9223372036854775808", "long long minimal");
+
+    // Aller-retour sur 5000 chiffres (conversion diviser pour régner)
+    char* long_texte = malloc(5001);
+    for (int i = 0; i < 5000; ++i) long_texte[i] = (char)('0' + (i * 7 + i / 13 + 1) % 10);
+    long_texte[5000] = '\0';
+    BigBinary grand = dec(long_texte);
+    char* relu = BigBinaryVersChaineDecimale(grand);
+    verifier(strcmp(relu, long_texte) == 0, "aller-retour d'un nombre de 5000 chiffres");
+    free(relu);
+    free(long_texte);
+    libereBigBinary(&grand);
+
+    // 60000 chiffres: les coupures passent par l'inverse de Newton et Barrett.
+    // 10^59999 et 10^60000 - 1 encadrent des puissances exactes du cache.
+    const int n_chiffres = 60000;
+    char* tres_long = malloc(n_chiffres + 2);
+    int ok_grands = 1;
+    for (int cas = 0; cas < 3; ++cas) {
+        for (int i = 0; i < n_chiffres; ++i) {
+            tres_long[i] = cas == 0 ? (char)('0' + (i * 7 + i / 11 + 3) % 10) : cas == 1 ? '0' : '9';
+        }
+        if (cas == 1) tres_long[0] = '1';
+        tres_long[n_chiffres] = '\0';
+        BigBinary nb = dec(tres_long);
+        char* texte = BigBinaryVersChaineDecimale(nb);
+        if (strcmp(texte, tres_long) != 0) {
+            printf("  cas %d: aller-retour faux\n", cas);
+            ok_grands = 0;
+        }
+        free(texte);
+        libereBigBinary(&nb);
+    }
+    verifier(ok_grands, "aller-retour de 60000 chiffres (quelconque, 10^59999, 10^60000 - 1)");
+    free(tres_long);
+}
+
+// Vérifie que la conversion hexadécimale de nb donne attendu, puis libère nb
+void verifier_hexa(BigBinary nb, const char* attendu, const char* description) {
+    char* texte = BigBinaryVersHexa(nb);
+    int ok = texte != NULL && strcmp(texte, attendu) == 0;
+    if (!ok) printf("  obtenu %s, attendu %s\n", texte ? texte : "(null)", attendu);
+    verifier(ok, description);
+    free(texte);
+    libereBigBinary(&nb);
+}
+
+void tester_hexa_et_octets() {
+    afficher_test_separateur("TEST: HEXADÉCIMAL ET OCTETS BRUTS");
+
+    verifier_valeur(creerBigBinaryDepuisHexa("0xdeadBEEF00112233445566778899"),
+                    "4516460495211091567017211098269849", "0xdeadBEEF00112233445566778899 en décimal");
+    verifier_valeur(creerBigBinaryDepuisHexa("-0x1F"), "-31", "-0x1F = -31");
+    verifier_hexa(dec("4516460495211091567017211098269849"), "deadbeef00112233445566778899", "décimal vers hexadécimal");
+    verifier_hexa(dec("-31"), "-1f", "-31 = -1f");
+    verifier_hexa(dec("0"), "0", "0 = 0");
+
+    // Octets: 0x0102...0x11 (17 octets, un de plus qu'un multiple de 8)
+    uint8_t octets[17];
+    for (int i = 0; i < 17; ++i) octets[i] = (uint8_t)(i + 1);
+    BigBinary gros = creerBigBinaryDepuisOctets(octets, 17, true);
+    verifier_hexa(copieBigBinary(gros), "102030405060708090a0b0c0d0e0f1011", "octets gros-boutistes");
+    BigBinary petit = creerBigBinaryDepuisOctets(octets, 17, false);
+    verifier_hexa(copieBigBinary(petit), "11100f0e0d0c0b0a090807060504030201", "octets petits-boutistes");
+    verifier(nombreOctets(gros) == 17, "nombreOctets = 17");
+
+    uint8_t sortie[20];
+    memset(sortie, 0xAA, sizeof(sortie));
+    size_t n = BigBinaryVersOctets(gros, sortie, 20, true);
+    verifier(n == 20 && sortie[0] == 0 && sortie[2] == 0 && memcmp(sortie + 3, octets, 17) == 0,
+             "export gros-boutiste complété à 20 octets");
+    n = BigBinaryVersOctets(gros, sortie, 17, false);
+    int ok = n == 17;
+    for (int i = 0; ok && i < 17; ++i) ok = sortie[i] == octets[16 - i];
+    verifier(ok, "export petit-boutiste");
+    verifier(BigBinaryVersOctets(gros, sortie, 16, true) == 0, "tampon trop petit: 0");
+
+    libereBigBinary(&gros);
+    libereBigBinary(&petit);
+}
+
+void tester_chaines_binaires() {
+    afficher_test_separateur("TEST: CHAÎNES BINAIRES (CONVERSION VECTORISÉE)");
+
+    // Toutes les longueurs de 1 à 300: bords des blocs vectoriels de 16 et 32 caractères
+    char texte[301];
+    int ok_bits = 1, ok_retour = 1;
+    for (int longueur = 1; longueur <= 300; ++longueur) {
+        texte[0] = '1';
+        for (int i = 1; i < longueur; ++i) texte[i] = ((i * i + longueur) % 3 == 0) ? '1' : '0';
+        texte[longueur] = '\0';
+
+        BigBinary nb = creerBigBinaryDepuisChaine(texte);
+        ok_bits = ok_bits && longueurBits(nb) == longueur;
+        for (int i = 0; ok_bits && i < longueur; ++i) {
+            ok_bits = testeBit(nb, longueur - 1 - i) == (texte[i] == '1');
+        }
+        char* relu = BigBinaryVersChaine(nb);
+        ok_retour = ok_retour && strcmp(relu, texte) == 0;
+        free(relu);
+        libereBigBinary(&nb);
+    }
+    verifier(ok_bits, "bits lus identiques pour les longueurs 1 à 300");
+    verifier(ok_retour, "aller-retour chaîne -> BigBinary -> chaîne pour les longueurs 1 à 300");
+
+    // Zéros de tête et séparateurs ignorés
+    verifier_valeur(creerBigBinaryDepuisChaine("0000000000000000000000000000000000001 0110"), "22",
+                    "zéros de tête et espaces ignorés");
+    verifier_valeur(creerBigBinaryDepuisChaine("0000000000000000000000000000000000000"), "0",
+                    "chaîne de zéros = 0");
+}
+
+/**
+ * \brief Fait calculer A + 0 au programme interactif et cherche A dans sa sortie
+ * \param operande Ligne saisie pour A (texte ou "@fichier")
+ * \param format 'b' ou 'd'
+ * \param attendu Écriture binaire attendue de A
+ */
+int interactif_affiche(const char* operande, char format, const char* attendu) {
+    FILE* script = fopen("test_phase2_script.txt", "w");
+    if (script == NULL) return 0;
+    // Addition, format, A, B = 0, deux lignes pour "Appuyez sur Entrée", puis Quitter
+    fprintf(script, "1\n%c\n%s\n0\n\n\n0\n", format, operande);
+    fclose(script);
+
+    if (system("./interactive < test_phase2_script.txt > test_phase2_sortie.txt") != 0) return 0;
+    long taille = 0;
+    unsigned char* sortie = lire_octets("test_phase2_sortie.txt", &taille);
+    if (sortie == NULL) return 0;
+    char* texte = malloc((size_t)taille + 1);
+    memcpy(texte, sortie, (size_t)taille);
+    texte[taille] = '\0';
+
+    char* motif = malloc(strlen(attendu) + 16);
+    sprintf(motif, "A + B = %s\n", attendu);
+    int trouve = strstr(texte, motif) != NULL;
+    free(motif);
+    free(texte);
+    free(sortie);
+    return trouve;
+}
+
+void tester_lecture_operandes() {
+    afficher_test_separateur("TEST: OPÉRANDES DU MODE INTERACTIF (SANS LIMITE DE TAILLE, @FICHIER)");
+
+    // 20000 bits: bien au-delà du tampon de lecture initial
+    char* bits = malloc(20001);
+    bits[0] = '1';
+    for (int i = 1; i < 20000; ++i) bits[i] = (i % 7 == 0 || i % 11 == 0) ? '1' : '0';
+    bits[20000] = '\0';
+    verifier(interactif_affiche(bits, 'b', bits), "opérande binaire de 20000 caractères saisie sur une ligne");
+
+    FILE* f = fopen("test_phase2_operande.txt", "w");
+    if (f != NULL) {
+        fputs(bits, f);
+        fclose(f);
+    }
+    verifier(interactif_affiche("@ test_phase2_operande.txt ", 'b', bits), "opérande binaire chargée par @fichier");
+
+    // 3000 chiffres décimaux
+    char* chiffres = malloc(3001);
+    for (int i = 0; i < 3000; ++i) chiffres[i] = (char)('1' + (i * 3) % 9);
+    chiffres[3000] = '\0';
+    BigBinary nb = dec(chiffres);
+    char* attendu = BigBinaryVersChaine(nb);
+    verifier(interactif_affiche(chiffres, 'd', attendu), "opérande décimale de 3000 chiffres");
+    verifier(!interactif_affiche("@test_phase2_absent.txt", 'b', "1"), "fichier absent: pas de résultat");
+
+    free(attendu);
+    libereBigBinary(&nb);
+    free(chiffres);
+    free(bits);
+    remove("test_phase2_script.txt");
+    remove("test_phase2_sortie.txt");
+    remove("test_phase2_operande.txt");
+}
+
+void tester_vues() {
+    afficher_test_separateur("TEST: VUES EN LECTURE SEULE (SANS COPIE)");
+
+    // Cases 0 0 1 0 1 1 0 1: vue normalisée sur 101101 = 45
+    int cases[8] = {0, 0, 1, 0, 1, 1, 0, 1};
+    VueBigBinary vue = vueBigBinary(cases, 8, -1);
+    verifier(vue.Tdigits == cases + 2 && vue.Taille == 6 && vue.Partage == NULL, "zéros de tête sautés sans copie");
+    verifier_valeur(copieBigBinary(vue), "-45", "valeur de la vue: -45");
+    VueBigBinary vueNulle = vueBigBinary(cases, 2, 1);
+    verifier(estNul(vueNulle) && vueNulle.Signe == 0, "vue sur des zéros = 0");
+
+    BigBinary A = dec("-265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    VueBigBinary absolu = vueValeurAbsolue(A);
+    VueBigBinary hauts = vueBitsHauts(absolu, 67);
+    VueBigBinary bas = vueBitsBas(absolu, 100);
+    verifier(hauts.Tdigits == A.Tdigits && absolu.Tdigits == A.Tdigits, "bits hauts et valeur absolue: préfixe du tableau");
+    verifier_valeur(copieBigBinary(hauts), "1799870398636025204067182234339325754178701793953510951717753442955869615556",
+                    "vueBitsHauts = |A| >> 67");
+    verifier_valeur(copieBigBinary(bas), "546134270262313552435893285025", "vueBitsBas = |A| mod 2^100");
+    verifier_valeur(Addition(absolu, A), "0", "|A| + A = 0");
+    verifier(vueBitsHauts(A, 67).Signe == -1 && vueBitsBas(A, 100).Signe == -1, "les vues gardent le signe de nb");
+    verifier(estNul(vueBitsHauts(A, 400)), "vueBitsHauts au-delà de la taille = 0");
+
+    // rendreUnique sur une vue: copie privée, le tableau d'origine n'est pas touché
+    BigBinary privee = bas;
+    rendreUnique(&privee);
+    verifier(privee.Partage != NULL && privee.Tdigits != bas.Tdigits && Egal(privee, bas), "rendreUnique copie la vue");
+    effaceBit(&privee, 0);
+    verifier(testeBit(A, 0) && !testeBit(privee, 0), "écrire dans la copie laisse A intact");
+    libereBigBinary(&privee);
+    libereBigBinary(&A);
+}
+
+void tester_copie_sur_ecriture() {
+    afficher_test_separateur("TEST: COPIE SUR ÉCRITURE");
+
+    BigBinary A = dec("265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+    BigBinary B = copieBigBinary(A);
+    BigBinary C = copieBigBinary(B);
+    verifier(B.Tdigits == A.Tdigits && C.Tdigits == A.Tdigits && *A.Partage == 3, "copies: un seul tableau, 3 références");
+
+    // Modifications en place: seule la copie modifiée reçoit un tableau privé
+    decaleGaucheEnPlace(&B, 10);
+    verifier(B.Tdigits != A.Tdigits && *A.Partage == 2 && *B.Partage == 1, "decaleGaucheEnPlace détache la copie");
+    effaceBit(&C, 0);
+    verifier(C.Tdigits != A.Tdigits && *A.Partage == 1, "effaceBit détache la copie");
+    verifier_valeur(copieBigBinary(A),
+                    "265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001",
+                    "l'original n'a pas changé");
+    verifier_valeur(decaleDroite(B, 10),
+                    "265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001",
+                    "la copie décalée vaut A * 2^10");
+
+    // Libérer l'original ne libère pas le tableau encore partagé
+    BigBinary D = copieBigBinary(A);
+    libereBigBinary(&A);
+    verifier(A.Tdigits == NULL && *D.Partage == 1, "libereBigBinary rend seulement sa référence");
+    verifier(poidsHamming(D) == 178, "la copie restante reste lisible");
+
+    // Un tableau possédé seul est modifié sans copie
+    int* avant = D.Tdigits;
+    rendreUnique(&D);
+    verifier(D.Tdigits == avant, "rendreUnique sans partage: aucune copie");
+
+    libereBigBinary(&B);
+    libereBigBinary(&C);
+    libereBigBinary(&D);
+}
+
+void tester_variantes_consommatrices() {
+    afficher_test_separateur("TEST: VARIANTES QUI CONSOMMENT LEURS ARGUMENTS");
+
+    const char* a = "265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001";
+    const char* b = "11450477594321044359340126713545146077054004823284978858214566372120240039594";
+
+    BigBinary diviseur = dec(b);  // Seulement lu
+    verifier_valeur(Modulo_consomme(dec(a), diviseur),
+                    "1070899271811779049303735016967845875860090566313191075423362162117308462849", "Modulo_consomme");
+    verifier_valeur(PGCD_consomme(dec("1234567890123456789012345678900"), dec("9876543210987654321098765432100")),
+                    "90000000009000000000900", "PGCD_consomme");
+
+    // Le PGCD est toujours positif, quel que soit le signe des opérandes
+    BigBinary m12 = dec("-12"), p18 = dec("18"), m18 = dec("-18"), zero = dec("0");
+    verifier_valeur(PGCD(m12, p18), "6", "PGCD(-12, 18) = 6");
+    verifier_valeur(PGCD(p18, m12), "6", "PGCD(18, -12) = 6");
+    verifier_valeur(PGCD(m12, m18), "6", "PGCD(-12, -18) = 6");
+    verifier_valeur(PGCD(m12, zero), "12", "PGCD(-12, 0) = 12");
+    verifier_valeur(PGCD(zero, m18), "18", "PGCD(0, -18) = 18");
+    verifier_valeur(PGCD(m18, p18), "18", "PGCD(-18, 18) = 18");
+    verifier_valeur(PGCD_consomme(dec("-1234567890123456789012345678900"), dec("9876543210987654321098765432100")),
+                    "90000000009000000000900", "PGCD_consomme: premier opérande négatif");
+    libereBigBinary(&m12);
+    libereBigBinary(&p18);
+    libereBigBinary(&m18);
+    libereBigBinary(&zero);
+
+    DivisionResult d = DivisionEuclidienne_consomme(dec(a), diviseur);
+    verifier_valeur(d.quotient, "23196760719186782608", "DivisionEuclidienne_consomme: quotient");
+    verifier_valeur(d.reste, "1070899271811779049303735016967845875860090566313191075423362162117308462849",
+                    "DivisionEuclidienne_consomme: reste");
+    libereBigBinary(&diviseur);
+
+    BigBinary n = dec("1211809");
+    verifier_valeur(ExpMod_consomme(dec("99999"), dec("101"), n), "561752", "ExpMod_consomme: exemple RSA jouet");
+    libereBigBinary(&n);
+
+    // deplacer: le contenu change de propriétaire, la source est vidée
+    BigBinary source = dec(a);
+    int* tableau = source.Tdigits;
+    BigBinary destination = deplacer(&source);
+    verifier(destination.Tdigits == tableau && source.Tdigits == NULL && source.Partage == NULL && source.Taille == 0,
+             "deplacer transfère le tableau sans copie");
+    libereBigBinary(&source);  // Sans effet sur une source vidée
+    libereBigBinary(&destination);
+}
+
+typedef struct {
+    int* passages;     // Nombre d'exécutions de chaque indice
+    int nb_threads;
+    int hors_bornes;   // Numéros de travailleur invalides
+} ControleLot;
+
+void tache_controle(int indice, int travailleur, void* contexte) {
+    ControleLot* c = contexte;
+    c->passages[indice]++;  // Chaque indice n'est donné qu'à un seul thread
+    if (travailleur < 0 || travailleur >= c->nb_threads) __atomic_add_fetch(&c->hors_bornes, 1, __ATOMIC_RELAXED);
+}
+
+void tester_pool_threads() {
+    afficher_test_separateur("TEST: POOL DE THREADS ET RSA PAR LOTS");
+
+    PoolThreads* pool = creerPoolThreads(4);
+    verifier(pool != NULL && nombreThreadsPool(pool) == 4, "pool de 4 threads");
+
+    int passages[1000] = {0};
+    ControleLot controle = {passages, 4, 0};
+    executerLot(pool, 1000, tache_controle, &controle);
+    executerLot(pool, 0, tache_controle, &controle);
+    int ok = controle.hors_bornes == 0;
+    for (int i = 0; ok && i < 1000; ++i) ok = passages[i] == 1;
+    verifier(ok, "executerLot: chaque indice exécuté une fois, numéros de thread valides");
+
+    // RSA jouet (p=1009, q=1201): chiffrement et déchiffrement de 37 messages
+    BigBinary N = dec("1211809"), E = dec("101"), D = dec("251501");
+    BigBinary messages[37], chiffres[37], dechiffres[37];
+    for (int i = 0; i < 37; ++i) messages[i] = creerBigBinaryDepuisDecimal(99999LL + 30000LL * i);
+    RSA_encryptLot(pool, messages, chiffres, 37, E, N);
+    RSA_decryptLot(pool, chiffres, dechiffres, 37, D, N);
+    verifier_valeur(copieBigBinary(chiffres[0]), "561752", "RSA_encryptLot: 99999^101 mod N = 561752");
+    int ok_chiffres = 1, ok_retour = 1;
+    for (int i = 0; i < 37; ++i) {
+        BigBinary attendu = RSA_encrypt(messages[i], E, N);
+        ok_chiffres = ok_chiffres && Egal(attendu, chiffres[i]);
+        ok_retour = ok_retour && Egal(messages[i], dechiffres[i]);
+        libereBigBinary(&attendu);
+        libereBigBinary(&messages[i]);
+        libereBigBinary(&chiffres[i]);
+        libereBigBinary(&dechiffres[i]);
+    }
+    verifier(ok_chiffres, "RSA_encryptLot = RSA_encrypt pour chaque message");
+    verifier(ok_retour, "RSA_decryptLot(RSA_encryptLot(M)) = M");
+
+    libereBigBinary(&N);
+    libereBigBinary(&E);
+    libereBigBinary(&D);
+    detruirePoolThreads(pool);
+}
+
+// Valeurs de référence calculées indépendamment (Python, reste dans [0, N))
+static const char* LOT_N = "115792089237342390393211096473342943949313232746809673270778931389365205055153";
+static const char* LOT_BASES[9] = {
+        "18437032639754944118572129431363063890647413010085012961351793046159338238438",
+        "-18437032639754944118572129431363063890647413010085012961351793046159338238438",
+        "134229121877097334511783225904706007839960645756894686232130724435524543293591",
+        "0",
+        "1",
+        "115792089237342390393211096473342943949313232746809673270778931389365205055152",
+        "-115792089237342390393211096473342943949313232746809673270778931389365205055152",
+        "2",
+        "515377520732011331036461129765621272702107522001"};
+static const char* LOT_EXPOSANTS[9] = {
+        "17",
+        "17",
+        "65537",
+        "5",
+        "0",
+        "2",
+        "3",
+        "115792089237342390393211096473342943949313232746809673270778931389365205055151",
+        "12345"};
+static const char* LOT_PUISSANCES[9] = {
+        "2",
+        "115792089237342390393211096473342943949313232746809673270778931389365205055151",
+        "84730224223733583654415980856226950608376176653359307596590219230998135560895",
+        "0",
+        "1",
+        "1",
+        "1",
+        "76236354028672542076209204853439638319610279510309963883596219193470009803413",
+        "77148074536198434005044077093225897411907960451858335972665106871452238898258"};
+static const char* LOT_PRODUITS[9] = {
+        "81845376401149269229304007386486198242379555677825873801422619005978339943140",
+        "33946712836193121163907089086856745706933677068983799469356312383386865112013",
+        "17356919951928945703854843907498090275922728982553867534311818118635381989651",
+        "0",
+        "0",
+        "115792089237342390393211096473342943949313232746809673270778931389365205055151",
+        "3",
+        "115792089237342390393211096473342943949313232746809673270778931389365205055149",
+        "6362335493436679881645112646956594611507517359102345"};
+
+// Compare ExpModLot / multiplicationModLot aux valeurs attendues et aux versions scalaires
+void verifier_lots_montgomery(const char* noyau) {
+    char desc[128];
+    BigBinary N = dec(LOT_N);
+    BigBinary bases[9], exposants[9], puissances[9], produits[9];
+    for (int i = 0; i < 9; ++i) {
+        bases[i] = dec(LOT_BASES[i]);
+        exposants[i] = dec(LOT_EXPOSANTS[i]);
+    }
+    ExpModLot(bases, exposants, puissances, 9, N);
+    multiplicationModLot(bases, exposants, produits, 9, N);
+
+    int ok_puissances = 1, ok_produits = 1, ok_scalaires = 1;
+    for (int i = 0; i < 9; ++i) {
+        BigBinary p = dec(LOT_PUISSANCES[i]), q = dec(LOT_PRODUITS[i]);
+        BigBinary ps = ExpMod(bases[i], exposants[i], N);
+        BigBinary qs = multiplicationMod(bases[i], exposants[i], N);
+        ok_puissances = ok_puissances && Egal(puissances[i], p);
+        ok_produits = ok_produits && Egal(produits[i], q);
+        ok_scalaires = ok_scalaires && Egal(puissances[i], ps) && Egal(produits[i], qs);
+        libereBigBinary(&p);
+        libereBigBinary(&q);
+        libereBigBinary(&ps);
+        libereBigBinary(&qs);
+        libereBigBinary(&bases[i]);
+        libereBigBinary(&exposants[i]);
+        libereBigBinary(&puissances[i]);
+        libereBigBinary(&produits[i]);
+    }
+    snprintf(desc, sizeof desc, "ExpModLot: 9 puissances (bases négatives, >= N, nulles) [%s]", noyau);
+    verifier(ok_puissances, desc);
+    snprintf(desc, sizeof desc, "multiplicationModLot: 9 produits [%s]", noyau);
+    verifier(ok_produits, desc);
+    snprintf(desc, sizeof desc, "lots identiques à ExpMod / multiplicationMod [%s]", noyau);
+    verifier(ok_scalaires, desc);
+
+    // Module pair: pas de Montgomery, repli sur les versions scalaires
+    BigBinary mille = dec("1000");
+    BigBinary b[2] = {dec("-12"), dec("123456789")};
+    BigBinary e[2] = {dec("7"), dec("3")};
+    BigBinary r[2], m[2];
+    ExpModLot(b, e, r, 2, mille);
+    multiplicationModLot(b, e, m, 2, mille);
+    snprintf(desc, sizeof desc, "module pair: (-12)^7 mod 1000 = 192 [%s]", noyau);
+    verifier_valeur(r[0], "192", desc);
+    verifier_valeur(r[1], "69", "module pair: 123456789^3 mod 1000");
+    snprintf(desc, sizeof desc, "module pair: (-12 * 7) mod 1000 = 916 [%s]", noyau);
+    verifier_valeur(m[0], "916", desc);
+    verifier_valeur(m[1], "367", "module pair: 123456789 * 3 mod 1000");
+    for (int i = 0; i < 2; ++i) {
+        libereBigBinary(&b[i]);
+        libereBigBinary(&e[i]);
+    }
+    libereBigBinary(&mille);
+    libereBigBinary(&N);
+}
+
+void tester_lots_montgomery() {
+    afficher_test_separateur("TEST: EXPONENTIATION MODULAIRE PAR LOTS");
+
+    choisirExtensions(0);
+    verifier_lots_montgomery("C portable");
+    choisirExtensions(BIGBINARY_EXT_TOUTES);
+    verifier_lots_montgomery(lotMontgomeryVectorise() ? "AVX2" : "meilleur noyau");
+
+    // RSA par lots avec des messages négatifs: (-M)^e = -(M^e) mod N pour e impair
+    PoolThreads* pool = creerPoolThreads(2);
+    BigBinary N = dec(LOT_N), E = dec("17");
+    BigBinary A = dec("18437032639754944118572129431363063890647413010085012961351793046159338238438");
+    BigBinary messages[3] = {copieBigBinary(A), dec("-5"), copieBigBinary(A)};
+    messages[0].Signe = -1;
+    BigBinary chiffres[3];
+    RSA_encryptLot(pool, messages, chiffres, 3, E, N);
+    verifier_valeur(chiffres[0], "115792089237342390393211096473342943949313232746809673270778931389365205055151", "RSA_encryptLot: (-A)^17 mod N = N - 2");
+    verifier_valeur(chiffres[1], "115792089237342390393211096473342943949313232746809673270778931388602265602028", "RSA_encryptLot: (-5)^17 mod N");
+    verifier_valeur(chiffres[2], "2", "RSA_encryptLot: A^17 mod N = 2");
+
+    BigBinary sept = dec("7"), trois = dec("3"), r;
+    RSA_encryptLot(pool, &messages[1], &r, 1, trois, sept);
+    verifier_valeur(r, "1", "RSA_encryptLot: (-5)^3 mod 7 = 1");
+    for (int i = 0; i < 3; ++i) libereBigBinary(&messages[i]);
+    libereBigBinary(&sept);
+    libereBigBinary(&trois);
+    libereBigBinary(&A);
+    libereBigBinary(&N);
+    libereBigBinary(&E);
+    detruirePoolThreads(pool);
+}
+
+// Masques essayés: les mêmes choix que BIGBINARY_EXTENSIONS permet
+static const unsigned int MASQUES_EXTENSIONS[6] = {
+    0, BIGBINARY_EXT_BMI2, BIGBINARY_EXT_BMI2 | BIGBINARY_EXT_ADX,
+    BIGBINARY_EXT_AVX2, BIGBINARY_EXT_AVX512, BIGBINARY_EXT_TOUTES
+};
+static const char* NOMS_MASQUES[6] = {"aucune", "bmi2", "bmi2,adx", "avx2", "avx512", "toutes"};
+
+// Produit de référence bit à bit: somme des A * 2^i pour les bits de B (sans noyau de multiplication)
+BigBinary produit_reference(BigBinary A, BigBinary B) {
+    BigBinary somme = creerZero();
+    for (int i = 0; i < longueurBits(B); ++i) {
+        if (!testeBit(B, i)) continue;
+        BigBinary terme = decaleGauche(A, i);
+        BigBinary suivante = Addition(somme, terme);
+        libereBigBinary(&terme);
+        libereBigBinary(&somme);
+        somme = suivante;
+    }
+    return somme;
+}
+
+// base^k par multiplications successives par un entier natif
+BigBinary puissance_ui(uint64_t base, int k) {
+    BigBinary resultat = creerBigBinaryDepuisDecimal(1);
+    for (int i = 0; i < k; ++i) {
+        BigBinary suivant = Multiplication_ui(resultat, base);
+        libereBigBinary(&resultat);
+        resultat = suivant;
+    }
+    return resultat;
+}
+
+// M^e mod n par carrés et multiplications de référence
+BigBinary expmod_reference(BigBinary M, BigBinary e, BigBinary n) {
+    BigBinary resultat = creerBigBinaryDepuisDecimal(1);
+    for (int i = longueurBits(e) - 1; i >= 0; --i) {
+        BigBinary carre = produit_reference(resultat, resultat);
+        libereBigBinary(&resultat);
+        resultat = Modulo(carre, n);
+        libereBigBinary(&carre);
+        if (testeBit(e, i)) {
+            BigBinary produit = produit_reference(resultat, M);
+            libereBigBinary(&resultat);
+            resultat = Modulo(produit, n);
+            libereBigBinary(&produit);
+        }
+    }
+    return resultat;
+}
+
+void tester_choix_noyaux() {
+    afficher_test_separateur("TEST: CHOIX DES NOYAUX SELON LE PROCESSEUR");
+    char desc[128];
+
+    verifier(choisirExtensions(0) == 0 && extensionsActives() == 0, "choisirExtensions(0): C portable seulement");
+
+    // A = 3^1300, B = 5^900 (plus de 2000 bits chacun)
+    BigBinary A = puissance_ui(3, 1300), B = puissance_ui(5, 900);
+    BigBinary reference = produit_reference(A, B);
+    const uint64_t p61 = (1ULL << 61) - 1;
+    verifier(longueurBits(reference) == 4151 && Modulo_ui(reference, p61) == 704140705515033716ULL,
+             "produit de référence 3^1300 * 5^900 (4151 bits, reste mod 2^61-1)");
+
+    unsigned int detectees = extensionsDetectees();
+    for (int m = 0; m < 6; ++m) {
+        unsigned int actives = choisirExtensions(MASQUES_EXTENSIONS[m]);
+        snprintf(desc, sizeof desc, "BIGBINARY_EXTENSIONS=%s: extensions actives autorisées et détectées", NOMS_MASQUES[m]);
+        verifier(actives == extensionsActives() && (actives & ~(MASQUES_EXTENSIONS[m] & detectees)) == 0, desc);
+
+        BigBinary produit = MultiplicationEgyptienne(A, B);
+        BigBinary carre = MultiplicationEgyptienne(A, A);
+        snprintf(desc, sizeof desc, "BIGBINARY_EXTENSIONS=%s: produit et carré sur les limbes", NOMS_MASQUES[m]);
+        verifier(Egal(produit, reference) && Modulo_ui(carre, p61) == 994035526682572142ULL, desc);
+        libereBigBinary(&produit);
+        libereBigBinary(&carre);
+    }
+    choisirExtensions(BIGBINARY_EXT_TOUTES);
+
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+    libereBigBinary(&reference);
+}
+
+// Opérandes de taille RSA: n = 3^k + 2 (impair), A = 5^a, B = 7^b, e = 11^c,
+// avec les empreintes (reste mod 2^61 - 1) calculées indépendamment
+typedef struct {
+    int bits;
+    int k, a, b, c;
+    uint64_t produit_mod;  // (A * B) mod n
+    uint64_t puissance_f4; // A^65537 mod n
+    uint64_t puissance;    // A^e mod n
+} CasRsa;
+
+// Compare produits et exponentiations sous chaque masque au calcul bit à bit et aux empreintes
+void verifier_cas_rsa(const CasRsa* cas) {
+    char desc[160];
+    const uint64_t p61 = (1ULL << 61) - 1;
+    BigBinary trois_k = puissance_ui(3, cas->k);
+    BigBinary n = Addition_ui(trois_k, 2);
+    libereBigBinary(&trois_k);
+    BigBinary A = puissance_ui(5, cas->a), B = puissance_ui(7, cas->b), e = puissance_ui(11, cas->c);
+    BigBinary f4 = creerBigBinaryDepuisDecimal(65537);
+
+    BigBinary produit_ref = produit_reference(A, B);
+    BigBinary produit_mod_ref = Modulo(produit_ref, n);
+    BigBinary puissance_f4_ref = expmod_reference(A, f4, n);
+    snprintf(desc, sizeof desc, "%d bits: références bit à bit conformes aux empreintes", cas->bits);
+    verifier(longueurBits(n) == cas->bits && Modulo_ui(produit_mod_ref, p61) == cas->produit_mod
+             && Modulo_ui(puissance_f4_ref, p61) == cas->puissance_f4, desc);
+
+    BigBinary puissance_portable = creerZero();
+    for (int m = 0; m < 6; ++m) {
+        choisirExtensions(MASQUES_EXTENSIONS[m]);
+        BigBinary produit = MultiplicationEgyptienne(A, B);
+        BigBinary produit_mod = multiplicationMod(A, B, n);
+        BigBinary puissance_f4 = ExpMod(A, f4, n);
+        BigBinary puissance = ExpMod(A, e, n);
+        if (m == 0) puissance_portable = copieBigBinary(puissance);
+
+        snprintf(desc, sizeof desc, "%d bits, BIGBINARY_EXTENSIONS=%s: A*B, A*B mod n, A^65537 mod n",
+                 cas->bits, NOMS_MASQUES[m]);
+        verifier(Egal(produit, produit_ref) && Egal(produit_mod, produit_mod_ref)
+                 && Egal(puissance_f4, puissance_f4_ref), desc);
+        snprintf(desc, sizeof desc, "%d bits, BIGBINARY_EXTENSIONS=%s: A^e mod n (e de %d bits)",
+                 cas->bits, NOMS_MASQUES[m], longueurBits(e));
+        verifier(Modulo_ui(puissance, p61) == cas->puissance && Egal(puissance, puissance_portable), desc);
+
+        libereBigBinary(&produit);
+        libereBigBinary(&produit_mod);
+        libereBigBinary(&puissance_f4);
+        libereBigBinary(&puissance);
+    }
+    choisirExtensions(BIGBINARY_EXT_TOUTES);
+
+    libereBigBinary(&puissance_portable);
+    libereBigBinary(&produit_ref);
+    libereBigBinary(&produit_mod_ref);
+    libereBigBinary(&puissance_f4_ref);
+    libereBigBinary(&n);
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+    libereBigBinary(&e);
+    libereBigBinary(&f4);
+}
+
+void tester_noyaux_rsa() {
+    afficher_test_separateur("TEST: NOYAUX MULX/ADCX/ADOX (TAILLES RSA)");
+
+    // Nombres de limbes hors tailles fixes: chemins addmul et réduction de Montgomery
+    static const CasRsa cas[2] = {
+        {1100, 694, 471, 390, 317, 223355330422058095ULL, 764333581773679644ULL, 1858526263827205571ULL},
+        {2500, 1577, 1074, 889, 722, 1741867602446957729ULL, 1832051971065703907ULL, 2018858274790748186ULL},
+    };
+    for (int i = 0; i < 2; ++i) verifier_cas_rsa(&cas[i]);
+}
+
+void tester_tailles_fixes() {
+    afficher_test_separateur("TEST: TAILLES FIXES 1024 À 4096 BITS");
+    char desc[128];
+
+    static const CasRsa cas[4] = {
+        {1024, 646, 438, 363, 296, 99674645221540111ULL, 1596466807742734585ULL, 1017388054091187956ULL},
+        {2048, 1292, 879, 728, 592, 2037894346795134736ULL, 1203439754956143100ULL, 392913335137347241ULL},
+        {3072, 1938, 1320, 1093, 888, 1822103260011164726ULL, 393297749337237637ULL, 2305445497037822953ULL},
+        {4096, 2584, 1761, 1457, 1184, 1757494891695857269ULL, 2154768846206109062ULL, 1447757634881069763ULL},
+    };
+    for (int i = 0; i < 4; ++i) verifier_cas_rsa(&cas[i]);
+
+    // Limbes tous à 1: n = 2^k - 1, A = n - 1 = -1 mod n (retenues sur toute la longueur)
+    BigBinary f4 = creerBigBinaryDepuisDecimal(65537);
+    for (int i = 0; i < 4; ++i) {
+        int bits = cas[i].bits;
+        BigBinary deux_k = creerZero();
+        metBit(&deux_k, bits);
+        BigBinary n = Soustraction_ui(deux_k, 1), A = Soustraction_ui(deux_k, 2);
+        BigBinary carre = multiplicationMod(A, A, n);
+        BigBinary puissance = ExpMod(A, f4, n);
+        BigBinary produit = MultiplicationEgyptienne(n, n);
+        BigBinary attendu = produit_reference(n, n);  // 2^2k - 2^(k+1) + 1
+        snprintf(desc, sizeof desc, "%d bits, n = 2^%d - 1: (n-1)^2 = 1, (n-1)^65537 = n-1, n*n", bits, bits);
+        verifier(longueurBits(carre) == 1 && Egal(puissance, A) && Egal(produit, attendu), desc);
+        libereBigBinary(&deux_k);
+        libereBigBinary(&carre);
+        libereBigBinary(&puissance);
+        libereBigBinary(&produit);
+        libereBigBinary(&attendu);
+
+        // Addition: la retenue traverse toutes les limbes et sort de la taille fixe
+        BigBinary deux_k1 = creerZero();
+        metBit(&deux_k1, bits + 1);
+        BigBinary somme = Addition(n, A);
+        BigBinary somme_attendue = Soustraction_ui(deux_k1, 3);  // 2^(k+1) - 3
+        snprintf(desc, sizeof desc, "%d bits: (2^%d - 1) + (2^%d - 2) = 2^%d - 3", bits, bits, bits, bits + 1);
+        verifier(Egal(somme, somme_attendue), desc);
+        libereBigBinary(&deux_k1);
+        libereBigBinary(&somme);
+        libereBigBinary(&somme_attendue);
+        libereBigBinary(&n);
+        libereBigBinary(&A);
+    }
+    libereBigBinary(&f4);
+}
+
+// Nombre de bits pseudo-aléatoires (générateur congruentiel, bit de poids fort forcé à 1)
+BigBinary bits_pseudo_aleatoires(uint64_t graine, int bits) {
+    BigBinary nb = creerZero();
+    metBit(&nb, bits - 1);  // Taille finale dès le départ: pas de réallocation par bit
+    uint64_t x = graine;
+    for (int i = 0; i < bits; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        if (x >> 63) metBit(&nb, i);
+    }
+    return nb;
+}
+
+void tester_multiplication_parallele() {
+    afficher_test_separateur("TEST: MULTIPLICATION PARALLÈLE (TRÈS GRANDS NOMBRES)");
+    const uint64_t p61 = (1ULL << 61) - 1;
+    PoolThreads* pool = creerPoolThreads(4);
+
+    BigBinary A = bits_pseudo_aleatoires(1, 140000), B = bits_pseudo_aleatoires(2, 150000);
+    verifier(Modulo_ui(A, p61) == 733319750934520274ULL && Modulo_ui(B, p61) == 389979350592295989ULL,
+             "opérandes de 140 et 150 Kbits");
+    BigBinary parallele = MultiplicationParallele(pool, A, B);
+    BigBinary sequentiel = MultiplicationEgyptienne(A, B);
+    verifier(longueurBits(parallele) == 290000 && Modulo_ui(parallele, p61) == 24473859182904680ULL,
+             "MultiplicationParallele: A * B (290000 bits, reste mod 2^61-1)");
+    verifier(Egal(parallele, sequentiel), "MultiplicationParallele = MultiplicationEgyptienne");
+    libereBigBinary(&parallele);
+
+    A.Signe = -1;
+    parallele = MultiplicationParallele(pool, A, B);
+    verifier(parallele.Signe == -1 && ComparerMagnitude(parallele, sequentiel) == 0, "(-A) * B = -(A * B)");
+    libereBigBinary(&parallele);
+    libereBigBinary(&sequentiel);
+
+    // (2^k - 1) * (2^k + 1) = 2^(2k) - 1
+    BigBinary deux_k = creerZero();
+    metBit(&deux_k, 200000);
+    BigBinary moins = Soustraction_ui(deux_k, 1), plus = Addition_ui(deux_k, 1);
+    parallele = MultiplicationParallele(pool, moins, plus);
+    verifier(longueurBits(parallele) == 400000 && poidsHamming(parallele) == 400000,
+             "MultiplicationParallele: (2^200000 - 1) * (2^200000 + 1) = 2^400000 - 1");
+    libereBigBinary(&parallele);
+
+    // Sous le seuil: même résultat que le produit séquentiel
+    BigBinary petit = bits_pseudo_aleatoires(3, 3000);
+    parallele = MultiplicationParallele(pool, petit, B);
+    sequentiel = MultiplicationEgyptienne(petit, B);
+    verifier(Egal(parallele, sequentiel), "MultiplicationParallele sous le seuil = produit séquentiel");
+
+    libereBigBinary(&parallele);
+    libereBigBinary(&sequentiel);
+    libereBigBinary(&petit);
+    libereBigBinary(&deux_k);
+    libereBigBinary(&moins);
+    libereBigBinary(&plus);
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+    detruirePoolThreads(pool);
+}
+
+// Lot de travaux lancé depuis un autre thread que celui du test
+typedef struct {
+    PoolThreads* pool;
+    Travail* travaux;
+    int nb;
+} LotConcurrent;
+
+void* executer_travaux_concurrents(void* arg) {
+    LotConcurrent* lot = arg;
+    struct timespec attente = {0, 20000000};
+    nanosleep(&attente, NULL);  // Laisse la multiplication de l'autre thread démarrer
+    executerTravaux(lot->pool, lot->travaux, lot->nb, NULL);
+    return NULL;
+}
+
+void tester_travaux_en_masse() {
+    afficher_test_separateur("TEST: TRAVAUX EN MASSE PAR VOL DE TÂCHES");
+    enum { NB_TRAVAUX = 300 };
+    PoolThreads* pool = creerPoolThreads(4);
+    int nb_threads = nombreThreadsPool(pool);
+
+    // Deux travaux à résultat connu, puis des PGCD et des modulos de tailles variées
+    Travail* travaux = calloc(NB_TRAVAUX, sizeof(Travail));
+    BigBinary trois_200 = puissance_ui(3, 200);
+    travaux[0] = (Travail){TRAVAIL_PGCD, Multiplication_ui(trois_200, 32), puissance_ui(6, 150), {0}};
+    travaux[1] = (Travail){TRAVAIL_MODULO, puissance_ui(7, 300), dec("100000000000000000039"), {0}};
+    libereBigBinary(&trois_200);
+    for (int i = 2; i < NB_TRAVAUX; ++i) {
+        travaux[i].type = i % 2 ? TRAVAIL_MODULO : TRAVAIL_PGCD;
+        travaux[i].a = bits_pseudo_aleatoires(10 + i, 64 + 5 * i);
+        travaux[i].b = bits_pseudo_aleatoires(1000 + i, 32 + 3 * i);
+    }
+
+    StatistiquesTravailleur* stats = calloc(nb_threads, sizeof(StatistiquesTravailleur));
+    executerTravaux(pool, travaux, NB_TRAVAUX, stats);
+
+    verifier_valeur(copieBigBinary(travaux[0].resultat),
+                    "11839631521124063133590425038454292613967139212471135162085900969655943968",
+                    "PGCD(2^5 * 3^200, 6^150) = 2^5 * 3^150");
+    verifier_valeur(copieBigBinary(travaux[1].resultat), "42718345651064608162",
+                    "7^300 mod (10^20 + 39)");
+    int ok = 1;
+    for (int i = 0; i < NB_TRAVAUX; ++i) {
+        BigBinary attendu = travaux[i].type == TRAVAIL_PGCD ? PGCD(travaux[i].a, travaux[i].b)
+                                                           : Modulo(travaux[i].a, travaux[i].b);
+        ok = ok && Egal(attendu, travaux[i].resultat);
+        libereBigBinary(&attendu);
+    }
+    verifier(ok, "executerTravaux: 300 résultats identiques à PGCD / Modulo");
+
+    long total = 0;
+    int stats_valides = 1;
+    for (int t = 0; t < nb_threads; ++t) {
+        total += stats[t].travaux;
+        stats_valides = stats_valides && stats[t].tranchesVolees >= 0
+                        && stats[t].utilisation >= 0.0 && stats[t].utilisation <= 1.0;
+    }
+    verifier(total == NB_TRAVAUX && stats_valides, "statistiques: somme des travaux = 300, utilisation dans [0, 1]");
+
+    executerTravaux(pool, travaux, 0, stats);
+    total = 0;
+    for (int t = 0; t < nb_threads; ++t) total += stats[t].travaux;
+    verifier(total == 0, "executerTravaux sans travail");
+
+    // Un thread extérieur au pool qui attend sa multiplication parallèle vole
+    // des tranches de travaux lancés entre-temps par un autre thread
+    enum { NB_LOURDS = 32 };
+    Travail lourds[NB_LOURDS];
+    for (int i = 0; i < NB_LOURDS; ++i) {
+        lourds[i] = (Travail){TRAVAIL_MODULO, bits_pseudo_aleatoires(50 + i, 8000),
+                              bits_pseudo_aleatoires(90 + i, 300), {0}};
+    }
+    PoolThreads* deux = creerPoolThreads(2);
+    LotConcurrent lot = {deux, lourds, NB_LOURDS};
+    BigBinary A = bits_pseudo_aleatoires(1, 1000000), B = bits_pseudo_aleatoires(2, 1000000);
+    pthread_t autre;
+    pthread_create(&autre, NULL, executer_travaux_concurrents, &lot);
+    BigBinary produit = MultiplicationParallele(deux, A, B);
+    pthread_join(autre, NULL);
+    BigBinary sequentiel = MultiplicationEgyptienne(A, B);
+    verifier(Egal(produit, sequentiel), "MultiplicationParallele pendant un lot de travaux d'un autre thread");
+    libereBigBinary(&sequentiel);
+    ok = 1;
+    for (int i = 0; i < NB_LOURDS; ++i) {
+        BigBinary attendu = Modulo(lourds[i].a, lourds[i].b);
+        ok = ok && Egal(attendu, lourds[i].resultat);
+        libereBigBinary(&attendu);
+        libereBigBinary(&lourds[i].a);
+        libereBigBinary(&lourds[i].b);
+        libereBigBinary(&lourds[i].resultat);
+    }
+    verifier(ok, "travaux concurrents: résultats identiques, tranches volées hors du pool comprises");
+    libereBigBinary(&produit);
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+    detruirePoolThreads(deux);
+
+    for (int i = 0; i < NB_TRAVAUX; ++i) {
+        libereBigBinary(&travaux[i].a);
+        libereBigBinary(&travaux[i].b);
+        libereBigBinary(&travaux[i].resultat);
+    }
+    free(travaux);
+    free(stats);
+    detruirePoolThreads(pool);
+}
+
+void rappel_compteur(Futur* futur, void* contexte) {
+    (void)futur;
+    __atomic_add_fetch((int*)contexte, 1, __ATOMIC_RELAXED);
+}
+
+void tester_futurs() {
+    afficher_test_separateur("TEST: CALCULS ASYNCHRONES (FUTURS)");
+    const uint64_t p61 = (1ULL << 61) - 1;
+    int rappels = 0;
+
+    // Un seul thread: le long calcul l'occupe, les suivants restent en file
+    PoolThreads* pool = creerPoolThreads(1);
+    BigBinary trois_k = puissance_ui(3, 2584);
+    BigBinary n = Addition_ui(trois_k, 2), M = puissance_ui(5, 1761);
+    BigBinary deux_30000 = creerZero();
+    metBit(&deux_30000, 30000);
+    BigBinary e = Soustraction_ui(deux_30000, 1), sept = creerBigBinaryDepuisDecimal(7);
+
+    Futur* long_calcul = lancerExpMod(pool, M, e, n, rappel_compteur, &rappels);
+    libereBigBinary(&M);  // Arguments partagés: libérables aussitôt
+    while (etatFutur(long_calcul) == FUTUR_EN_FILE) attendreFutur(long_calcul, 1);
+    Futur* en_file = lancerExpMod(pool, sept, sept, n, rappel_compteur, &rappels);
+    BigBinary A = puissance_ui(7, 300), B = dec("100000000000000000039");
+    Futur* division = lancerDivisionEuclidienne(pool, A, B, rappel_compteur, &rappels);
+
+    verifier(!attendreFutur(long_calcul, 5), "attendreFutur: délai de 5 ms expiré sur un long calcul");
+    verifier(annulerFutur(en_file) && etatFutur(en_file) == FUTUR_ANNULE, "annulerFutur sur un futur en file");
+    BigBinary annule = resultatFutur(en_file, NULL);
+    verifier(attendreFutur(en_file, 0) && !annulerFutur(en_file) && estNul(annule),
+             "futur annulé: fini, sans résultat, pas annulable deux fois");
+    libereBigBinary(&annule);
+
+    int descripteur = descripteurFutur(long_calcul);
+#if defined(__linux__)
+    struct pollfd attente = {descripteur, POLLIN, 0};
+    verifier(descripteur >= 0 && poll(&attente, 1, -1) == 1 && (attente.revents & POLLIN),
+             "descripteurFutur: lisible à la fin du calcul");
+#else
+    verifier(descripteur == -1, "descripteurFutur: -1 hors Linux");
+#endif
+    verifier(attendreFutur(long_calcul, -1) && etatFutur(long_calcul) == FUTUR_TERMINE
+             && !annulerFutur(long_calcul), "attendreFutur sans limite, futur terminé non annulable");
+    BigBinary puissance = resultatFutur(long_calcul, NULL);
+    verifier(Modulo_ui(puissance, p61) == 291853070101126951ULL,
+             "lancerExpMod: 5^1761^(2^30000 - 1) mod (3^2584 + 2)");
+
+    BigBinary reste;
+    verifier(attendreFutur(division, -1), "lancerDivisionEuclidienne terminée");
+    BigBinary quotient = resultatFutur(division, &reste);
+    BigBinary produit = MultiplicationEgyptienne(quotient, B);
+    BigBinary recompose = Addition(produit, reste);
+    verifier(Egal(recompose, A), "lancerDivisionEuclidienne: quotient * B + reste = A");
+    verifier_valeur(reste, "42718345651064608162", "lancerDivisionEuclidienne: reste de 7^300 / (10^20 + 39)");
+
+    // Le rappel suit la fin du futur sur le thread du pool: compté une fois le pool arrêté
+    detruirePoolThreads(pool);
+    verifier(rappels == 2, "rappel appelé pour les deux futurs terminés, pas pour l'annulé");
+
+    libererFutur(long_calcul);
+    libererFutur(en_file);
+    libererFutur(division);
+    libereBigBinary(&puissance);
+    libereBigBinary(&quotient);
+    libereBigBinary(&produit);
+    libereBigBinary(&recompose);
+    libereBigBinary(&trois_k);
+    libereBigBinary(&deux_30000);
+    libereBigBinary(&n);
+    libereBigBinary(&e);
+    libereBigBinary(&sept);
+    libereBigBinary(&A);
+    libereBigBinary(&B);
+}
+
+void tester_expmod_parallele() {
+    afficher_test_separateur("TEST: EXPONENTIATION PARALLÈLE D'UN TRÈS GRAND EXPOSANT");
+    const uint64_t p61 = (1ULL << 61) - 1;
+    char desc[128];
+    PoolThreads* pool = creerPoolThreads(4);
+
+    // n = 3^1292 + 2 (2048 bits), M = 5^879; exposants de 5000 à 7000 bits
+    BigBinary trois_k = puissance_ui(3, 1292);
+    BigBinary n = Addition_ui(trois_k, 2), M = puissance_ui(5, 879);
+    BigBinary exposants[3] = {bits_pseudo_aleatoires(7, 6000), creerZero(), bits_pseudo_aleatoires(8, 7000)};
+    metBit(&exposants[0], 0);          // Impair
+    metBit(&exposants[1], 5000);       // 2^5000 + 1: tranches du milieu nulles
+    metBit(&exposants[1], 0);
+    static const uint64_t attendus[3] = {120351665802484413ULL, 342496610540495352ULL, 940472109862693092ULL};
+    static const char* noms[3] = {"e de 6000 bits", "e = 2^5000 + 1", "e de 7000 bits"};
+
+    PuissancesBase* table = precalculerPuissancesBase(pool, M, n, 6000);
+    BigBinary references[3];
+    for (int i = 0; i < 3; ++i) {
+        references[i] = ExpMod(M, exposants[i], n);
+        BigBinary precalcule = ExpModPrecalcule(pool, table, exposants[i]);
+        snprintf(desc, sizeof desc, "ExpModPrecalcule = ExpMod (%s%s)", noms[i],
+                 i == 2 ? ", au-delà de la table" : "");
+        verifier(Modulo_ui(references[i], p61) == attendus[i] && Egal(precalcule, references[i]), desc);
+        libereBigBinary(&precalcule);
+    }
+    liberePuissancesBase(table);
+
+    // Base négative, exposant impair: (-M)^e = n - M^e mod n
+    M.Signe = -1;
+    BigBinary oppose = Soustraction(n, references[0]);
+    table = precalculerPuissancesBase(pool, M, n, 6000);
+    BigBinary precalcule = ExpModPrecalcule(pool, table, exposants[0]);
+    verifier(Egal(precalcule, oppose) && Modulo_ui(precalcule, p61) == 1651099257560072814ULL,
+             "ExpModPrecalcule: (-M)^e mod n = n - M^e mod n");
+    libereBigBinary(&precalcule);
+    liberePuissancesBase(table);
+    M.Signe = 1;
+
+    BigBinary moins_cinq = dec("-5"), trois = dec("3"), sept = dec("7");
+    table = precalculerPuissancesBase(pool, moins_cinq, sept, 2);
+    verifier_valeur(ExpModPrecalcule(pool, table, trois), "1", "ExpModPrecalcule: (-5)^3 mod 7 = 1");
+    liberePuissancesBase(table);
+
+    libereBigBinary(&moins_cinq);
+    libereBigBinary(&trois);
+    libereBigBinary(&sept);
+    libereBigBinary(&oppose);
+    for (int i = 0; i < 3; ++i) {
+        libereBigBinary(&exposants[i]);
+        libereBigBinary(&references[i]);
+    }
+    libereBigBinary(&trois_k);
+    libereBigBinary(&n);
+    libereBigBinary(&M);
+    detruirePoolThreads(pool);
+}
+
+// Facteur attendu d'un module: indice d'un premier, ou le module entier, ou aucun
+enum { FACTEUR_AUCUN = -1, FACTEUR_MODULE = -2 };
+
+// Compare les facteurs de PGCDParLots aux facteurs connus
+int facteurs_conformes(const BigBinary* modules, const BigBinary* premiers, const int* attendus,
+                       const BigBinary* facteurs, int nb) {
+    int ok = 1;
+    for (int i = 0; i < nb; ++i) {
+        BigBinary attendu = attendus[i] == FACTEUR_AUCUN ? creerBigBinaryDepuisDecimal(1)
+                          : attendus[i] == FACTEUR_MODULE ? copieBigBinary(modules[i])
+                          : copieBigBinary(premiers[attendus[i]]);
+        ok = ok && Egal(facteurs[i], attendu);
+        libereBigBinary(&attendu);
+    }
+    return ok;
+}
+
+// PGCD(modules[i], produit des autres) par le calcul direct: produit des autres réduit mod modules[i]
+BigBinary facteur_reference(const BigBinary* modules, int nb, int i) {
+    BigBinary produit = creerBigBinaryDepuisDecimal(1);
+    for (int j = 0; j < nb; ++j) {
+        if (j == i) continue;
+        BigBinary suivant = multiplicationMod(produit, modules[j], modules[i]);
+        libereBigBinary(&produit);
+        produit = suivant;
+    }
+    BigBinary facteur = PGCD(modules[i], produit);
+    libereBigBinary(&produit);
+    return facteur;
+}
+
+void tester_pgcd_par_lots() {
+    afficher_test_separateur("TEST: PGCD PAR LOTS (AUDIT DE MODULES RSA)");
+    enum { NB_PREMIERS = 14, NB_MODULES = 9 };
+    PoolThreads* pool = creerPoolThreads(4);
+
+    // Premiers de 128 bits: 2^127 + d
+    static const int decalages[NB_PREMIERS] = {29, 45, 65, 101, 123, 251, 273, 303, 395, 479, 485, 503, 545, 575};
+    BigBinary deux_127 = creerZero();
+    metBit(&deux_127, 127);
+    BigBinary premiers[NB_PREMIERS];
+    for (int i = 0; i < NB_PREMIERS; ++i) premiers[i] = Addition_ui(deux_127, decalages[i]);
+
+    // Modules p*q; certains partagent un premier (m0 avec m1 et m8, m3 avec m4, m6 avec m7)
+    static const int paires[NB_MODULES][2] = {
+        {0, 1}, {0, 2}, {3, 4}, {5, 6}, {6, 7}, {8, 9}, {10, 11}, {10, 12}, {1, 13}
+    };
+    static const int attendus[NB_MODULES] = {
+        FACTEUR_MODULE, 0, FACTEUR_AUCUN, 6, 6, FACTEUR_AUCUN, 10, 10, 1
+    };
+    BigBinary modules[NB_MODULES], facteurs[NB_MODULES];
+    for (int i = 0; i < NB_MODULES; ++i) {
+        modules[i] = MultiplicationEgyptienne(premiers[paires[i][0]], premiers[paires[i][1]]);
+    }
+
+    long faibles = PGCDParLots(pool, modules, NB_MODULES, facteurs, NULL, 0);
+    verifier(faibles == 7 && facteurs_conformes(modules, premiers, attendus, facteurs, NB_MODULES),
+             "PGCDParLots en mémoire: 7 modules faibles, facteurs partagés retrouvés");
+    for (int i = 0; i < NB_MODULES; ++i) libereBigBinary(&facteurs[i]);
+
+    // Tous les niveaux de l'arbre sur disque, dans un répertoire vidé ensuite
+    char repertoire[] = "test_phase2_XXXXXX";
+    verifier(mkdtemp(repertoire) != NULL, "répertoire temporaire créé");
+    faibles = PGCDParLots(pool, modules, NB_MODULES, facteurs, repertoire, 1);
+    verifier(faibles == 7 && facteurs_conformes(modules, premiers, attendus, facteurs, NB_MODULES),
+             "PGCDParLots avec débordement sur disque: mêmes facteurs");
+    verifier(rmdir(repertoire) == 0, "niveaux temporaires supprimés");
+    for (int i = 0; i < NB_MODULES; ++i) libereBigBinary(&facteurs[i]);
+
+    faibles = PGCDParLots(pool, modules, 1, facteurs, NULL, 0);
+    verifier(faibles == 0, "PGCDParLots sur un seul module: aucun module faible");
+    verifier_valeur(facteurs[0], "1", "PGCDParLots sur un seul module: facteur 1");
+
+    // Audit d'un fichier: paires (module faible, facteur) dans l'ordre des modules
+    const char* entree = "test_phase2_modules.bbin";
+    const char* sortie = "test_phase2_faibles.bbin";
+    verifier(ecrireFichierBigBinary(entree, modules, NB_MODULES, false), "fichier de modules écrit");
+    faibles = auditerModulesFichier(pool, entree, sortie, NULL, 0);
+    FichierBigBinary resultat;
+    int ok = faibles == 7 && ouvrirFichierBigBinary(sortie, &resultat);
+    if (ok) {
+        size_t k = 0;
+        ok = resultat.nb == 14;
+        for (int i = 0; ok && i < NB_MODULES; ++i) {
+            if (attendus[i] == FACTEUR_AUCUN) continue;
+            BigBinary attendu = attendus[i] == FACTEUR_MODULE ? modules[i] : premiers[attendus[i]];
+            ok = Egal(resultat.nombres[k], modules[i]) && Egal(resultat.nombres[k + 1], attendu);
+            k += 2;
+        }
+        fermerFichierBigBinary(&resultat);
+    }
+    verifier(ok, "auditerModulesFichier: 7 paires (module, facteur)");
+    verifier(auditerModulesFichier(pool, "test_phase2_absent.bbin", sortie, NULL, 0) == -1,
+             "auditerModulesFichier: fichier absent");
+    remove(entree);
+    remove(sortie);
+
+    for (int i = 0; i < NB_MODULES; ++i) libereBigBinary(&modules[i]);
+    for (int i = 0; i < NB_PREMIERS; ++i) libereBigBinary(&premiers[i]);
+    libereBigBinary(&deux_127);
+    detruirePoolThreads(pool);
+
+    // Tailles réalistes: 256 modules de 2048 à 4096 bits sur 2 threads (les
+    // produits du haut de l'arbre passent par Karatsuba en parallèle).
+    // Chaque module est le produit de deux facteurs impairs pseudo-aléatoires;
+    // les modules 32k et 32k + 1 partagent un facteur planté.
+    enum { NB_GRANDS = 256, NB_PLANTES = NB_GRANDS / 32 };
+    PoolThreads* deux = creerPoolThreads(2);
+    BigBinary plantes[NB_PLANTES], grands[NB_GRANDS], facteurs_grands[NB_GRANDS];
+    for (int k = 0; k < NB_PLANTES; ++k) {
+        plantes[k] = bits_pseudo_aleatoires(7000 + k, 1024 + 64 * k);
+        metBit(&plantes[k], 0);
+    }
+    for (int i = 0; i < NB_GRANDS; ++i) {
+        int bits = 2048 + 8 * i;
+        BigBinary p = i % 32 < 2 ? copieBigBinary(plantes[i / 32]) : bits_pseudo_aleatoires(3000 + i, bits / 2);
+        BigBinary q = bits_pseudo_aleatoires(5000 + i, bits - longueurBits(p));
+        metBit(&p, 0);
+        metBit(&q, 0);
+        grands[i] = MultiplicationEgyptienne(p, q);
+        libereBigBinary(&p);
+        libereBigBinary(&q);
+    }
+
+    faibles = PGCDParLots(deux, grands, NB_GRANDS, facteurs_grands, NULL, 0);
+    ok = faibles >= 2 * NB_PLANTES;
+    for (int k = 0; ok && k < NB_PLANTES; ++k) {
+        for (int i = 32 * k; i < 32 * k + 2; ++i) {
+            BigBinary reste = Modulo(facteurs_grands[i], plantes[k]);
+            ok = ok && estNul(reste);
+            libereBigBinary(&reste);
+        }
+    }
+    verifier(ok, "PGCDParLots sur 256 modules de 2048 à 4096 bits: facteurs plantés retrouvés");
+    static const int echantillon[] = {0, 1, 2, 33, 100, 255};
+    ok = 1;
+    for (int s = 0; s < (int)(sizeof(echantillon) / sizeof(echantillon[0])); ++s) {
+        BigBinary attendu = facteur_reference(grands, NB_GRANDS, echantillon[s]);
+        ok = ok && Egal(attendu, facteurs_grands[echantillon[s]]);
+        libereBigBinary(&attendu);
+    }
+    verifier(ok, "PGCDParLots sur 256 modules: facteurs identiques au calcul direct (échantillon)");
+
+    for (int i = 0; i < NB_GRANDS; ++i) {
+        libereBigBinary(&grands[i]);
+        libereBigBinary(&facteurs_grands[i]);
+    }
+    for (int k = 0; k < NB_PLANTES; ++k) libereBigBinary(&plantes[k]);
+    detruirePoolThreads(deux);
+}
+
+void tester_arithmetique_signee() {
+    afficher_test_separateur("TEST: ADDITION, SOUSTRACTION ET MULTIPLICATION MODULAIRE SIGNÉES");
+
+    BigBinary m5 = dec("-5"), m3 = dec("-3"), p3 = dec("3"), p7 = dec("7"), p11 = dec("11");
+
+    verifier_valeur(Addition(m5, p3), "-2", "-5 + 3 = -2");
+    verifier_valeur(Addition(m5, m3), "-8", "-5 + -3 = -8");
+    verifier_valeur(Soustraction(p3, p7), "-4", "3 - 7 = -4");
+    verifier_valeur(Soustraction(m5, m3), "-2", "-5 - -3 = -2");
+    verifier_valeur(Soustraction(p3, p3), "0", "3 - 3 = 0");
+
+    // Résultat toujours dans [0, n), quel que soit le signe des opérandes
+    verifier_valeur(multiplicationMod(m5, p7, p7), "0", "(-5 * 7) mod 7 = 0");
+    verifier_valeur(multiplicationMod(m3, p7, p11), "1", "(-3 * 7) mod 11 = 1");
+    verifier_valeur(multiplicationMod(p7, m3, p11), "1", "(7 * -3) mod 11 = 1");
+    verifier_valeur(multiplicationMod(m3, m3, p11), "9", "(-3 * -3) mod 11 = 9");
+    verifier_valeur(multiplicationMod(p3, p7, p11), "10", "(3 * 7) mod 11 = 10");
+    verifier_valeur(ExpMod(m5, p3, p7), "1", "(-5)^3 mod 7 = 1");
+    verifier_valeur(ExpModInt(m5, 3, p7), "1", "ExpModInt: (-5)^3 mod 7 = 1");
+    verifier_valeur(ExpMod(m3, p3, p11), "6", "(-3)^3 mod 11 = 6");
+    verifier_valeur(ExpModInt(m3, 2, p11), "9", "ExpModInt: (-3)^2 mod 11 = 9");
+
+    // Grand module: (-A)^17 = -(A^17) = N - 2 (données du document)
+    BigBinary N = dec("115792089237342390393211096473342943949313232746809673270778931389365205055153");
+    BigBinary A = dec("-18437032639754944118572129431363063890647413010085012961351793046159338238438");
+    verifier_valeur(ExpModInt(A, 17, N),
+                    "115792089237342390393211096473342943949313232746809673270778931389365205055151",
+                    "(-A)^17 mod N = N - 2");
+
+    libereBigBinary(&m5);
+    libereBigBinary(&m3);
+    libereBigBinary(&p3);
+    libereBigBinary(&p7);
+    libereBigBinary(&p11);
+    libereBigBinary(&N);
+    libereBigBinary(&A);
+}
+
+// Allocateur de test: compte les blocs en circulation et note le plus grand alignement demandé
+// (compteurs atomiques: les travailleurs d'un pool y puisent aussi)
+typedef struct {
+    long blocs;
+    long allocations;
+    size_t alignement_max;
+    size_t plafond;  // Taille au-delà de laquelle allouer renvoie NULL (0 = aucun)
+} CompteurMemoire;
+
+void* allouer_compte(size_t taille, size_t alignement, void* contexte) {
+    CompteurMemoire* c = contexte;
+    if (c->plafond > 0 && taille > c->plafond) return NULL;
+    void* ptr = NULL;
+    if (posix_memalign(&ptr, alignement < sizeof(void*) ? sizeof(void*) : alignement, taille) != 0) return NULL;
+    __atomic_add_fetch(&c->blocs, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&c->allocations, 1, __ATOMIC_RELAXED);
+    if (alignement > __atomic_load_n(&c->alignement_max, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&c->alignement_max, alignement, __ATOMIC_RELAXED);
+    }
+    return ptr;
+}
+
+void liberer_compte(void* ptr, size_t taille, size_t alignement, void* contexte) {
+    (void)taille;
+    (void)alignement;
+    CompteurMemoire* c = contexte;
+    __atomic_sub_fetch(&c->blocs, 1, __ATOMIC_RELAXED);
+    free(ptr);
+}
+
+void tester_allocateur() {
+    afficher_test_separateur("TEST: ALLOCATEUR PERSONNALISÉ");
+
+    CompteurMemoire compteur = {0, 0, 0, 0};
+    AllocateurBigBinary allocateur = {allouer_compte, NULL, liberer_compte, &compteur};
+    definirAllocateur(&allocateur);
+
+    // Tableaux de bits: l'alignement demandé est celui de l'en-tête, pas sa taille
+    BigBinary a = creerBigBinaryDepuisChaine("1011");
+    BigBinary b = creerBigBinaryDepuisChaine("110");
+    BigBinary s = Addition(a, b);
+    verifier(compteur.allocations > 0, "les tableaux de bits passent par l'allocateur");
+    verifier(compteur.alignement_max <= 16, "alignement des tableaux de bits <= celui de malloc");
+
+    // Noyaux sur limbes (grand module) et réallocation sans reallouer
+    BigBinary N = dec("115792089237342390393211096473342943949313232746809673270778931389365205055153");
+    BigBinary A = dec("18437032639754944118572129431363063890647413010085012961351793046159338238438");
+    verifier_valeur(ExpModInt(A, 17, N), "2", "A^17 mod N = 2 avec l'allocateur de test");
+    decaleGaucheEnPlace(&s, 200);
+    verifier_valeur(decaleDroite(s, 200), "17", "décalage en place (réallocation) puis retour");
+
+    // Pool de threads: les caches des travailleurs puisent dans l'allocateur global
+    long avant_pool = compteur.allocations;
+    PoolThreads* pool = creerPoolThreads(2);
+    BigBinary dix_sept = dec("17"), deux = dec("2");
+    BigBinary messages[16], chiffres[16];
+    for (int i = 0; i < 16; ++i) messages[i] = A;
+    RSA_encryptLot(pool, messages, chiffres, 16, dix_sept, N);
+    int justes = 0;
+    for (int i = 0; i < 16; ++i) {
+        justes += Egal(chiffres[i], deux);
+        libereBigBinary(&chiffres[i]);
+    }
+    verifier(justes == 16, "lot RSA avec l'allocateur de test: 16 fois A^17 mod N = 2");
+    verifier(compteur.allocations > avant_pool + 16, "la mémoire de travail du pool vient de l'allocateur global");
+    detruirePoolThreads(pool);
+    libereBigBinary(&dix_sept);
+    libereBigBinary(&deux);
+
+    // L'allocateur du thread se lit pour être remis après un changement temporaire
+    verifier(allocateurThreadCourant() == NULL, "aucun allocateur de thread par défaut");
+    verifier(allocateurGlobalCourant() == &allocateur, "allocateur global lisible");
+    definirAllocateurThread(&allocateur);
+    verifier(allocateurThreadCourant() == &allocateur, "allocateur de thread lisible");
+    definirAllocateurThread(NULL);
+
+    libereBigBinary(&a);
+    libereBigBinary(&b);
+    libereBigBinary(&s);
+    libereBigBinary(&N);
+    libereBigBinary(&A);
+    definirAllocateur(NULL);
+    verifier(compteur.blocs == 0, "tous les blocs sont rendus à l'allocateur");
+
+    // Un refus (NULL) est fatal: abort() plutôt qu'un déréférencement de NULL
+    fflush(stdout);
+    pid_t fils = fork();
+    if (fils == 0) {
+        CompteurMemoire plafonne = {0, 0, 0, 1024};
+        AllocateurBigBinary refus = {allouer_compte, NULL, liberer_compte, &plafonne};
+        definirAllocateur(&refus);
+        BigBinary un = dec("1");
+        BigBinary grand = decaleGauche(un, 100000);
+        libereBigBinary(&grand);
+        libereBigBinary(&un);
+        _exit(0);
+    }
+    int statut = 0;
+    waitpid(fils, &statut, 0);
+    verifier(WIFSIGNALED(statut) && WTERMSIG(statut) == SIGABRT, "allocation refusée: arrêt par abort()");
+}
+
+// Inverse l'ordre des octets d'un mot de 'largeur' octets
+void inverser_mot(unsigned char* p, int largeur) {
+    for (int i = 0; i < largeur / 2; ++i) {
+        unsigned char t = p[i];
+        p[i] = p[largeur - 1 - i];
+        p[largeur - 1 - i] = t;
+    }
+}
+
+/**
+ * \brief Réécrit un fichier BigBinary comme l'aurait écrit une machine d'ordre d'octets opposé
+ *
+ * En-tête de 64 octets (4 mots de 32 bits après la magie, puis un de 64),
+ * index de 24 octets par entier, données en mots de 'unite' octets.
+ */
+void inverser_fichier(const char* source, const char* destination, int unite) {
+    long taille = 0;
+    unsigned char* o = lire_octets(source, &taille);
+    if (o == NULL) return;
+    uint64_t nombre;
+    memcpy(&nombre, o + 24, sizeof(nombre));
+
+    for (int champ = 8; champ < 24; champ += 4) inverser_mot(o + champ, 4);
+    inverser_mot(o + 24, 8);
+    for (uint64_t i = 0; i < nombre; ++i) {
+        unsigned char* entree = o + 64 + 24 * i;
+        inverser_mot(entree, 8);
+        inverser_mot(entree + 8, 8);
+        inverser_mot(entree + 16, 4);
+    }
+    long debut = (long)((64 + 24 * nombre + 63) / 64 * 64);
+    for (long p = debut; p + unite <= taille; p += unite) inverser_mot(o + p, unite);
+
+    ecrire_octets(destination, o, taille);
+    free(o);
+}
+
+// Relit chemin et compare aux nombres d'origine
+void verifier_relecture(const char* chemin, const BigBinary* nombres, int nb, int copies_attendues,
+                        const char* description) {
+    FichierBigBinary fichier;
+    int ok = ouvrirFichierBigBinary(chemin, &fichier);
+    if (ok) {
+        ok = (int)fichier.nb == nb && (int)fichier.copies == copies_attendues;
+        for (int i = 0; ok && i < nb; ++i) {
+            ok = Egal(fichier.nombres[i], nombres[i]) && fichier.nombres[i].Signe == nombres[i].Signe;
+        }
+        fermerFichierBigBinary(&fichier);
+    }
+    verifier(ok, description);
+}
+
+void tester_fichier_binaire() {
+    afficher_test_separateur("TEST: FORMAT DE FICHIER BINAIRE (MMAP)");
+
+    const char* cases = "test_phase2_cases.bbin";
+    const char* limbes = "test_phase2_limbes.bbin";
+    const char* inverse = "test_phase2_inverse.bbin";
+
+    BigBinary un = dec("1");
+    BigBinary nombres[5] = {
+        dec("0"), dec("1"), dec("-13"),
+        dec("1234567890123456789012345678901234567890123456789012345678901234567890"),
+        decaleGauche(un, 130),
+    };
+    libereBigBinary(&un);
+
+    verifier(ecrireFichierBigBinary(cases, nombres, 5, false), "écriture disposition CASES");
+    verifier_relecture(cases, nombres, 5, 0, "relecture CASES: vues sans copie, valeurs identiques");
+    verifier(ecrireFichierBigBinary(limbes, nombres, 5, true), "écriture disposition LIMBES");
+    verifier_relecture(limbes, nombres, 5, 1, "relecture LIMBES: valeurs identiques");
+
+    inverser_fichier(cases, inverse, 4);
+    verifier_relecture(inverse, nombres, 5, 1, "CASES écrit par une machine d'ordre d'octets opposé");
+    inverser_fichier(limbes, inverse, 8);
+    verifier_relecture(inverse, nombres, 5, 1, "LIMBES écrit par une machine d'ordre d'octets opposé");
+
+    // Fichier corrompu: une case qui n'est pas un bit doit être refusée
+    // (2e case du dernier entier, position lue dans son entrée d'index)
+    long taille = 0;
+    unsigned char* octets = lire_octets(cases, &taille);
+    FichierBigBinary fichier;
+    int corrompus[2] = {2, -7};
+    uint64_t position = 0;
+    if (octets != NULL) memcpy(&position, octets + 64 + 24 * 4, sizeof(position));
+    for (int c = 0; c < 2 && octets != NULL; ++c) {
+        memcpy(octets + position + sizeof(int), &corrompus[c], sizeof(int));
+        ecrire_octets(inverse, octets, taille);
+        int ouvert = ouvrirFichierBigBinary(inverse, &fichier);
+        if (ouvert) fermerFichierBigBinary(&fichier);
+        verifier(!ouvert, c == 0 ? "case à 2 refusée à l'ouverture" : "case à -7 refusée à l'ouverture");
+    }
+    free(octets);
+    verifier(!ouvrirFichierBigBinary("test_phase2_absent.bbin", &fichier), "fichier absent refusé");
+
+    // Cases de tête nulles (bit de poids fort du 4e entier effacé): nombres
+    // normalisés à l'ouverture, dans les deux ordres d'octets
+    BigBinary haut = creerZero();
+    metBit(&haut, longueurBits(nombres[3]) - 1);
+    BigBinary sans_haut = Soustraction(nombres[3], haut);
+    octets = lire_octets(cases, &taille);
+    const int zero_case = 0;
+    if (octets != NULL) memcpy(&position, octets + 64 + 24 * 3, sizeof(position));
+    for (int c = 0; c < 2 && octets != NULL; ++c) {
+        if (c == 0) {
+            memcpy(octets + position, &zero_case, sizeof(int));
+            ecrire_octets(inverse, octets, taille);
+        } else {
+            inverser_fichier(inverse, limbes, 4);
+        }
+        int ok = ouvrirFichierBigBinary(c == 0 ? inverse : limbes, &fichier);
+        if (ok) {
+            ok = fichier.nombres[3].Taille == longueurBits(sans_haut) && Egal(fichier.nombres[3], sans_haut)
+                 && ComparerMagnitude(fichier.nombres[3], nombres[3]) < 0 && Comparer(fichier.nombres[1], nombres[1]) == 0;
+            fermerFichierBigBinary(&fichier);
+        }
+        verifier(ok, c == 0 ? "cases de tête nulles: vue normalisée (taille, comparaisons)"
+                            : "cases de tête nulles, ordre d'octets opposé: copie normalisée");
+    }
+    free(octets);
+    libereBigBinary(&haut);
+    libereBigBinary(&sans_haut);
+
+    // Signe incohérent avec la valeur: 1 pour le zéro (1er entier), 0 pour -13 (3e)
+    static const int entrees_signe[2] = {0, 2}, signes_faux[2] = {1, 0};
+    for (int c = 0; c < 2; ++c) {
+        octets = lire_octets(cases, &taille);
+        if (octets == NULL) break;
+        int32_t signe = signes_faux[c];
+        memcpy(octets + 64 + 24 * entrees_signe[c] + 16, &signe, sizeof(signe));
+        ecrire_octets(inverse, octets, taille);
+        free(octets);
+        int ouvert = ouvrirFichierBigBinary(inverse, &fichier);
+        if (ouvert) fermerFichierBigBinary(&fichier);
+        verifier(!ouvert, c == 0 ? "zéro de signe 1 refusé à l'ouverture" : "entier non nul de signe 0 refusé");
+    }
+
+    remove(cases);
+    remove(limbes);
+    remove(inverse);
+    for (int i = 0; i < 5; ++i) libereBigBinary(&nombres[i]);
+}
+
 int main() {
     printf("╔════════════════════════════════════════════════════════════╗\n");
     printf("║     TESTS PHASE 2 - MULTIPLICATION ET MODULO              ║\n");
@@ -225,12 +1899,41 @@ int main() {
     tester_modulo_division_free();
     tester_exponentiation_document();
     tester_rsa_exemple_jouet();
+    tester_decalages();
+    tester_operations_bit_a_bit();
+    tester_comparaisons();
+    tester_operations_natives();
+    tester_diviseurs_prepares();
+    tester_conversions_decimales();
+    tester_hexa_et_octets();
+    tester_chaines_binaires();
+    tester_lecture_operandes();
+    tester_vues();
+    tester_copie_sur_ecriture();
+    tester_variantes_consommatrices();
+    tester_pool_threads();
+    tester_lots_montgomery();
+    tester_choix_noyaux();
+    tester_noyaux_rsa();
+    tester_tailles_fixes();
+    tester_multiplication_parallele();
+    tester_travaux_en_masse();
+    tester_futurs();
+    tester_expmod_parallele();
+    tester_pgcd_par_lots();
+    tester_arithmetique_signee();
+    tester_allocateur();
+    tester_fichier_binaire();
     
     printf("\n\n");
     printf("╔════════════════════════════════════════════════════════════╗\n");
     printf("║     FIN DES TESTS PHASE 2                                  ║\n");
     printf("╚════════════════════════════════════════════════════════════╝\n");
     
+    if (nb_echecs > 0) {
+        printf("\n✗ %d vérification(s) échouée(s)\n", nb_echecs);
+        return 1;
+    }
     return 0;
 }
 